@@ -82,6 +82,39 @@ istream *ZipFile::getInputStream( const string &entry_name,
 }
 
 
+ConstEntryPointer ZipFile::getRawData( const string &entry_name, string &data,
+                                      MatchPath matchpath ) {
+  if ( ! _valid )
+    throw InvalidStateException( "Attempt to use an invalid ZipFile" ) ;
+
+  ConstEntryPointer ent = getEntry( entry_name, matchpath ) ;
+  if ( !ent )
+    return ent ;
+
+  const ZipCDirEntry *cdir = static_cast< const ZipCDirEntry * >( ent.get() ) ;
+
+#if defined(_WIN32) && defined(ZIPIOS_UTF8)
+  std::wstring wsname = Base::FileInfo(_filename).toStdWString();
+  ifstream _zipfile( wsname.c_str(), ios::in | ios::binary ) ;
+#else
+  ifstream _zipfile( _filename.c_str(), ios::in | ios::binary ) ;
+#endif
+
+  // The local header may have a different extra field than the central
+  // directory, so read it to find where the data starts
+  ZipLocalEntry zlh ;
+  _vs.vseekg( _zipfile, cdir->getLocalHeaderOffset(), ios::beg ) ;
+  _zipfile >> zlh ;
+  data.resize( cdir->getCompressedSize() ) ;
+  if ( _zipfile && !data.empty() )
+    _zipfile.read( &data[ 0 ], data.size() ) ;
+  if ( ! _zipfile )
+    throw IOException( "Error reading zip file while reading entry data" ) ;
+
+  return ent ;
+}
+
+
 //
 // Private
 //
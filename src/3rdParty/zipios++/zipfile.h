@@ -65,6 +65,17 @@ public:
   virtual istream *getInputStream( const ConstEntryPointer &entry ) ;
   virtual istream *getInputStream( const string &entry_name, 
 				     MatchPath matchpath = MATCH ) ;
+
+  /** Reads the data of an entry the way it is stored in the archive,
+      i.e. without decompressing it. This allows to copy the entry to
+      another archive with ZipOutputStream::putRawEntry().
+      @param entry_name The name of the entry.
+      @param data Receives the stored data.
+      @return The central directory entry, or a null pointer if there
+      is no entry with that name.
+      @throw IOException Thrown if the data cannot be read. */
+  ConstEntryPointer getRawData( const string &entry_name, string &data,
+                                MatchPath matchpath = MATCH ) ;
 private:
   VirtualSeeker _vs ;
   EndOfCentralDirectory  _eocd ;
@@ -49,6 +49,19 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes a complete entry whose data has already been encoded by the
+      caller, e.g. compressed with raw deflate on another thread. Any
+      open entry is closed first, and no entry is open afterwards.
+      @param entry the entry to write.
+      @param data the encoded entry data.
+      @param compressed_size the number of bytes in data.
+      @param size the size of the entry before encoding.
+      @param crc the crc32 checksum of the entry before encoding.
+      @param method the storage method data is encoded with. */
+  void putRawEntry( const ZipCDirEntry &entry, const char *data,
+                    uint32 compressed_size, uint32 size, uint32 crc,
+                    StorageMethod method = DEFLATED ) ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -67,6 +67,7 @@
 #include <QCoreApplication>
 #include <QDir>
 #include <QFileInfo>
+#include <QProcess>
 #include <QProcessEnvironment>
 #include <QSettings>
 #include <QStandardPaths>
@@ -824,6 +825,117 @@ bool Application::isFineGrainedRecomputeEnabled()
     return enableFineGrainedRecompute;
 }
 
+bool Application::isParallelRecomputeEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableParallelRecompute = hGrp->GetBool("ParallelRecompute", false);
+    return enableParallelRecompute;
+}
+
+unsigned int Application::getRecomputeThreadCount()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    // A value of 0 means one thread per hardware core.
+    long threads = hGrp->GetInt("RecomputeThreads", 0);
+    if (threads <= 0) {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned int>(threads);
+}
+
+unsigned int Application::getSaveThreadCount()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    // A value of 0 means one thread per hardware core, 1 saves sequentially.
+    long threads = hGrp->GetInt("SaveThreads", 1);
+    if (threads <= 0) {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned int>(threads);
+}
+
+unsigned int Application::getRestoreThreadCount()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    // A value of 0 means one thread per hardware core, 1 restores sequentially.
+    long threads = hGrp->GetInt("RestoreThreads", 1);
+    if (threads <= 0) {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+    return static_cast<unsigned int>(threads);
+}
+
+bool Application::isRecomputeCacheEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableRecomputeCache = hGrp->GetBool("RecomputeCache", false);
+    return enableRecomputeCache;
+}
+
+bool Application::isLazyRestoreEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableLazyRestore = hGrp->GetBool("LazyRestore", false);
+    return enableLazyRestore;
+}
+
+bool Application::isIncrementalSaveEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableIncrementalSave = hGrp->GetBool("IncrementalSave", false);
+    return enableIncrementalSave;
+}
+
+bool Application::isCompiledExpressionEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Expression"
+    );
+    bool enableCompiledExpression = hGrp->GetBool("CompileExpressions", false);
+    return enableCompiledExpression;
+}
+
+bool Application::isIncrementalExpressionEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Expression"
+    );
+    bool enableIncrementalExpression = hGrp->GetBool("IncrementalEvaluation", false);
+    return enableIncrementalExpression;
+}
+
+bool Application::isCompactElementMapEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableCompactElementMap = hGrp->GetBool("CompactElementMap", false);
+    return enableCompactElementMap;
+}
+
+bool Application::isAsyncConsoleEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/General"
+    );
+    bool enableAsyncConsole = hGrp->GetBool("AsyncConsole", false);
+    return enableAsyncConsole;
+}
+
 bool Application::canRecomputeRequestOnWorker(const RecomputeRequest& req) const
 {
     if (DocumentObject* documentObject = req.resolveDocumentObject()) {
@@ -2060,6 +2172,8 @@ void Application::destruct()
 
 void Application::destructObserver()
 {
+    // deliver the messages still pending in the background thread
+    Base::Console().setAsyncMode(false);
     if ( _pConsoleObserverFile ) {
         Base::Console().detachObserver(_pConsoleObserverFile);
         delete _pConsoleObserverFile;
@@ -2446,6 +2560,9 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     ("disable-addon", boost::program_options::value< std::vector<std::string> >()->composing(),"Disable a given addon.")
     ("single-instance", "Allow to run a single instance of the application")
     ("safe-mode", "Force enable safe mode")
+    ("batch-jobs,j", boost::program_options::value<int>(), "Process the input documents in batch mode using the given number of worker processes")
+    ("batch-script", boost::program_options::value<std::string>(), "Python script to run on each document in batch mode")
+    ("batch-export", boost::program_options::value<std::string>(), "File extension to export each document to in batch mode")
     ("pass", boost::program_options::value< std::vector<std::string> >()->multitoken(), "Ignores the following arguments and pass them through to be used by a script")
     ;
 
@@ -2456,6 +2573,7 @@ void parseProgramOptions(int ac, char ** av, const std::string& exe, boost::prog
     hidden.add_options()
     ("input-file", boost::program_options::value< std::vector<std::string> >(), "input file")
     ("output",     boost::program_options::value<std::string>(),"output file")
+    ("batch-worker",                                       "process the documents read from the standard input as a worker of a batch run")
     ("hidden",                                             "don't show the main window")
     // this are to ignore for the window system (QApplication)
     ("style",      boost::program_options::value< std::string >(), "set the application GUI style")
@@ -2701,6 +2819,27 @@ void processProgramOptions(const boost::program_options::variables_map& vm, std:
         mConfig["SingleInstance"] = "1";
     }
 
+    if (vm.contains("batch-jobs")) {
+        mConfig["RunMode"] = "Batch";
+        mConfig["BatchJobs"] = std::to_string(std::max(1, vm["batch-jobs"].as<int>()));
+    }
+    else if (vm.contains("batch-worker")) {
+        mConfig["RunMode"] = "Batch";
+        mConfig["BatchJobs"] = "1";
+        mConfig["BatchWorker"] = "1";
+    }
+    else if (vm.contains("batch-script") || vm.contains("batch-export")) {
+        throw Base::UnknownProgramOption("--batch-script and --batch-export require --batch-jobs\n");
+    }
+
+    if (vm.contains("batch-script")) {
+        mConfig["BatchScript"] = vm["batch-script"].as<std::string>();
+    }
+
+    if (vm.contains("batch-export")) {
+        mConfig["BatchExport"] = vm["batch-export"].as<std::string>();
+    }
+
     if (vm.contains("dump-config")) {
         std::stringstream str;
         for (const auto & it : mConfig) {
@@ -3031,6 +3170,10 @@ void Application::initApplication()
         Base::Console().log("Create Application\n");
     Application::_pcSingleton = new Application(mConfig);
 
+    if (GetApplication().isAsyncConsoleEnabled()) {
+        Base::Console().setAsyncMode(true);
+    }
+
     // set up Unit system default
     const ParameterGrp::handle hGrp = GetApplication().GetParameterGroupByPath
        ("User parameter:BaseApp/Preferences/Units");
@@ -3149,6 +3292,120 @@ std::list<std::string> Application::processFiles(const std::list<std::string>& f
     return processed; // successfully processed files
 }
 
+namespace {
+
+// Exports the objects of the active document with the export module
+// registered for the extension of the given file. Returns false if there
+// is no such module.
+bool exportActiveDocument(const std::string& output)
+{
+    const Base::FileInfo fi(output);
+    const std::vector<std::string> mods = GetApplication().getExportModules(fi.extension());
+    if (mods.empty()) {
+        return false;
+    }
+
+    Base::Interpreter().loadModule(mods.front().c_str());
+    Base::Interpreter().runStringArg("import %s",mods.front().c_str());
+    Base::Interpreter().runStringArg("%s.export(App.ActiveDocument.Objects, '%s')"
+        ,mods.front().c_str(),output.c_str());
+    return true;
+}
+
+// Opens, recomputes, exports and closes a single document of a batch run.
+// Returns true if all steps succeeded and no object is left in error.
+bool processBatchDocument(const std::string& file, const std::string& script, const std::string& ext)
+{
+    try {
+        App::Document* doc = GetApplication().openDocument(file.c_str());
+        if (!doc) {
+            Base::Console().error("Batch: failed to open %s\n", file.c_str());
+            return false;
+        }
+        GetApplication().setActiveDocument(doc);
+
+        // The script may close the document itself, so close it by name and
+        // also if a step throws
+        const std::string name = doc->getName();
+        Base::ScopeGuard closer([&name] {
+            try {
+                if (GetApplication().getDocument(name.c_str())) {
+                    GetApplication().closeDocument(name.c_str());
+                }
+            }
+            catch (...) {
+                Base::Console().error("Batch: failed to close %s\n", name.c_str());
+            }
+        });
+
+        bool success = true;
+        doc->recompute();
+        for (auto obj : doc->getObjects()) {
+            if (obj->isError()) {
+                Base::Console().error("Batch: %s: failed to recompute %s\n",
+                                      file.c_str(), obj->getNameInDocument());
+                success = false;
+            }
+        }
+
+        if (!script.empty()) {
+            Base::Interpreter().runFile(script.c_str(), true);
+        }
+
+        if (!ext.empty()) {
+            const Base::FileInfo fi(file);
+            std::string output = fi.dirPath() + "/" + fi.fileNamePure() + "." + ext;
+            output = Base::Tools::escapeEncodeFilename(output);
+            if (!exportActiveDocument(output)) {
+                Base::Console().error("Batch: file format not supported: %s\n", output.c_str());
+                success = false;
+            }
+        }
+
+        doc = GetApplication().getDocument(name.c_str());
+        if (!doc) {
+            return success;
+        }
+        const auto usage = doc->getMemoryUsage();
+        auto megabytes = [](std::size_t size) {
+            return static_cast<double>(size) / (1024.0 * 1024.0);
+        };
+        std::size_t objects = 0;
+        for (const auto& [objName, size] : usage.objects) {
+            objects += size;
+        }
+        Base::Console().message("Batch: %s: memory %.1f MB (objects %.1f MB, element maps %.1f MB, "
+                                "string hasher %.1f MB, undo %.1f MB, redo %.1f MB)\n",
+                                file.c_str(), megabytes(usage.total()), megabytes(objects),
+                                megabytes(usage.elementMaps), megabytes(usage.stringHasher),
+                                megabytes(usage.undo), megabytes(usage.redo));
+        return success;
+    }
+    catch (const Base::SystemExitException&) {
+        throw;
+    }
+    catch (const Base::Exception& e) {
+        Base::Console().error("Batch: %s: %s\n", file.c_str(), e.what());
+    }
+    catch (const std::exception& e) {
+        Base::Console().error("Batch: %s: %s\n", file.c_str(), e.what());
+    }
+    catch (...) {
+        Base::Console().error("Batch: %s: unknown exception\n", file.c_str());
+    }
+    return false;
+}
+
+// Written by a batch worker after each document, followed by "done" or "failed"
+constexpr const char* batchResultTag = "\x1e" "batch-result ";
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
 void Application::processCmdLineFiles()
 {
     const std::list<std::string> files = getCmdLineFiles();
@@ -3174,16 +3431,8 @@ void Application::processCmdLineFiles()
         std::string output = it->second;
         output = Base::Tools::escapeEncodeFilename(output);
 
-        const Base::FileInfo fi(output);
         try {
-            const std::vector<std::string> mods = GetApplication().getExportModules(fi.extension());
-            if (!mods.empty()) {
-                Base::Interpreter().loadModule(mods.front().c_str());
-                Base::Interpreter().runStringArg("import %s",mods.front().c_str());
-                Base::Interpreter().runStringArg("%s.export(App.ActiveDocument.Objects, '%s')"
-                    ,mods.front().c_str(),output.c_str());
-            }
-            else {
+            if (!exportActiveDocument(output)) {
                 Base::Console().warning("File format not supported: %s \n", output.c_str());
             }
         }
@@ -3196,8 +3445,159 @@ void Application::processCmdLineFiles()
     }
 }
 
+int Application::runBatch(const std::list<std::string>& files, int jobs)
+{
+    const std::string script = mConfig["BatchScript"];
+    const std::string ext = mConfig["BatchExport"];
+    const std::vector<std::string> queue(files.begin(), files.end());
+    std::vector<bool> results(queue.size(), false);
+    std::vector<double> times(queue.size(), 0.0);
+    const auto batchStart = std::chrono::steady_clock::now();
+
+    if (mConfig["BatchWorker"] == "1") {
+        // The batch run that started this worker passes the documents one
+        // path per line and reports the results
+        int failed = 0;
+        std::string file;
+        while (std::getline(std::cin, file)) {
+            const bool success = processBatchDocument(file, script, ext);
+            failed += success ? 0 : 1;
+            Base::Console().flush();
+            std::cout << batchResultTag << (success ? "done" : "failed") << std::endl;
+        }
+        return failed;
+    }
+
+    if (jobs > 1) {
+        // The documents are processed by long-lived worker processes. A
+        // crashing or leaking document cannot affect this process, and each
+        // worker pays for the startup and module imports only once. The
+        // workers are started anew instead of forked from this process,
+        // because the application already runs threads a fork does not keep.
+        QStringList arguments {QStringLiteral("--batch-worker")};
+        if (!script.empty()) {
+            arguments << QStringLiteral("--batch-script") << QString::fromStdString(script);
+        }
+        if (!ext.empty()) {
+            arguments << QStringLiteral("--batch-export") << QString::fromStdString(ext);
+        }
+        const QString program = QString::fromLocal8Bit(_argv[0]);
+
+        struct Worker
+        {
+            std::unique_ptr<QProcess> process;
+            // the document being processed
+            std::optional<std::size_t> index;
+            std::chrono::steady_clock::time_point start;
+            bool closed {false};
+        };
+        std::list<Worker> workers;
+        auto startWorker = [&workers, &program, &arguments]() {
+            auto process = std::make_unique<QProcess>();
+            // The standard output carries the results, see batchResultTag
+            process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+            process->start(program, arguments);
+            if (!process->waitForStarted()) {
+                Base::Console().error("Batch: failed to start a worker\n");
+                return false;
+            }
+            workers.push_back(Worker {std::move(process), std::nullopt, {}});
+            return true;
+        };
+        auto report = [&](std::size_t index, bool success, std::chrono::steady_clock::time_point start) {
+            times[index] = secondsSince(start);
+            results[index] = success;
+            Base::Console().message("Batch: %s %s (%.3f s)\n", queue[index].c_str(),
+                                    success ? "done" : "failed", times[index]);
+        };
+        auto forward = [](const QByteArray& output) {
+            std::cout.write(output.constData(), output.size());
+        };
+
+        std::size_t next = 0;
+        for (int i = 0; i < jobs && static_cast<std::size_t>(i) < queue.size(); ++i) {
+            if (!startWorker()) {
+                break;
+            }
+        }
+        while (!workers.empty()) {
+            for (auto it = workers.begin(); it != workers.end();) {
+                Worker& worker = *it;
+                QProcess& process = *worker.process;
+                if (!worker.index && !worker.closed && process.state() == QProcess::Running) {
+                    if (next < queue.size()) {
+                        worker.index = next++;
+                        worker.start = std::chrono::steady_clock::now();
+                        process.write(QByteArray::fromStdString(queue[*worker.index] + '\n'));
+                    }
+                    else {
+                        // lets the worker exit
+                        process.closeWriteChannel();
+                        worker.closed = true;
+                    }
+                }
+                if (!process.canReadLine() && process.state() != QProcess::NotRunning) {
+                    process.waitForReadyRead(20);
+                }
+                while (process.canReadLine()) {
+                    const QByteArray line = process.readLine();
+                    if (worker.index && line.startsWith(batchResultTag)) {
+                        const QByteArray result = line.mid(qstrlen(batchResultTag)).trimmed();
+                        report(*worker.index, result == "done", worker.start);
+                        worker.index.reset();
+                    }
+                    else {
+                        forward(line);
+                    }
+                }
+                if (process.state() != QProcess::NotRunning) {
+                    ++it;
+                    continue;
+                }
+
+                forward(process.readAll());
+                if (worker.index) {
+                    Base::Console().error("Batch: %s: worker %s\n", queue[*worker.index].c_str(),
+                                          process.exitStatus() == QProcess::CrashExit ? "crashed"
+                                                                                      : "exited");
+                    report(*worker.index, false, worker.start);
+                }
+                it = workers.erase(it);
+                // replace a worker lost in the middle of the batch
+                if (next < queue.size()) {
+                    startWorker();
+                }
+            }
+        }
+        for (; next < queue.size(); ++next) {
+            report(next, false, std::chrono::steady_clock::now());
+        }
+    }
+    else {
+        for (std::size_t index = 0; index < queue.size(); ++index) {
+            const auto start = std::chrono::steady_clock::now();
+            results[index] = processBatchDocument(queue[index], script, ext);
+            times[index] = secondsSince(start);
+            Base::Console().message("Batch: %s %s (%.3f s)\n", queue[index].c_str(),
+                                    results[index] ? "done" : "failed", times[index]);
+        }
+    }
+
+    const auto failed = static_cast<int>(std::count(results.begin(), results.end(), false));
+    Base::Console().message("Batch: processed %d documents in %.3f s, %d failed\n",
+                            static_cast<int>(queue.size()), secondsSince(batchStart), failed);
+    return failed;
+}
+
 void Application::runApplication()
 {
+    if (mConfig["RunMode"] == "Batch") {
+        // the documents are opened by the batch workers
+        int failed = runBatch(getCmdLineFiles(), std::stoi(mConfig["BatchJobs"]));
+        mConfig["BatchFailed"] = std::to_string(failed);
+        return;
+    }
+
     // process all files given through command line interface
     processCmdLineFiles();
 
@@ -394,6 +394,28 @@ public:
     // Returns if document and object recomputes should be done async.
     bool isAsyncRecomputeEnabled();
     bool isFineGrainedRecomputeEnabled();
+    // Returns if independent objects of a document may be recomputed concurrently.
+    bool isParallelRecomputeEnabled();
+    // Returns the number of threads used by a parallel recompute.
+    unsigned int getRecomputeThreadCount();
+    // Returns if recompute results of cacheable objects should be reused.
+    bool isRecomputeCacheEnabled();
+    // Returns the number of threads used to write the files of a document archive.
+    unsigned int getSaveThreadCount();
+    // Returns the number of threads used to restore the properties of a document.
+    unsigned int getRestoreThreadCount();
+    // Returns if heavy data files of a document are only read on first access.
+    bool isLazyRestoreEnabled();
+    // Returns if saving copies unchanged data files from the previous archive.
+    bool isIncrementalSaveEnabled();
+    // Returns if expression bindings are evaluated from a compiled form when possible.
+    bool isCompiledExpressionEnabled();
+    // Returns if only expression bindings with changed inputs are evaluated.
+    bool isIncrementalExpressionEnabled();
+    // Returns if element maps of shapes stored in properties use the compact representation.
+    bool isCompactElementMapEnabled();
+    // Returns if the terminal and log file output is written by a background thread.
+    bool isAsyncConsoleEnabled();
     bool canRecomputeRequestOnWorker(const RecomputeRequest& req) const;
 
     // Adds a recompute request to the processing queue.
@@ -767,6 +789,23 @@ public:
     /// Run the application in a specific mode.
     static void runApplication();
 
+    /**
+     * @brief Process documents in batch mode.
+     *
+     * Every document is opened, recomputed, passed to the batch script, exported
+     * if requested and closed again. With more than one job the documents are
+     * handed out to up to @p jobs long-lived worker processes started with the
+     * same executable, otherwise they are processed one after another in this
+     * process. A worker reads the paths from its standard input and is replaced
+     * if it crashes. The time taken by each document is reported.
+     *
+     * @param[in] files The documents to process.
+     * @param[in] jobs The maximum number of concurrent worker processes.
+     *
+     * @return The number of documents that failed.
+     */
+    static int runBatch(const std::list<std::string>& files, int jobs);
+
     friend Application &GetApplication();
 
     /// Get the application configuration map.
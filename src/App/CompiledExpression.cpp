@@ -0,0 +1,908 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <Base/Interpreter.h>
+#include <Base/Quantity.h>
+#include <Base/QuantityPy.h>
+
+#include "CompiledExpression.h"
+#include "Application.h"
+#include "Document.h"
+#include "DocumentObject.h"
+#include "ExpressionParser.h"
+#include "PropertyStandard.h"
+#include "PropertyUnits.h"
+
+
+using namespace App;
+
+namespace
+{
+
+// Integers of larger magnitude are not exactly representable as double.
+constexpr double maxExactInteger = 9007199254740992.0;
+
+bool addInteger(long a, long b, long& res)
+{
+    if ((b > 0 && a > std::numeric_limits<long>::max() - b)
+        || (b < 0 && a < std::numeric_limits<long>::min() - b)) {
+        return false;
+    }
+    res = a + b;
+    return true;
+}
+
+bool subtractInteger(long a, long b, long& res)
+{
+    if ((b < 0 && a > std::numeric_limits<long>::max() + b)
+        || (b > 0 && a < std::numeric_limits<long>::min() + b)) {
+        return false;
+    }
+    res = a - b;
+    return true;
+}
+
+bool multiplyInteger(long a, long b, long& res)
+{
+    constexpr long max = std::numeric_limits<long>::max();
+    constexpr long min = std::numeric_limits<long>::min();
+    if (a > 0) {
+        if ((b > 0 && a > max / b) || (b < 0 && b < min / a)) {
+            return false;
+        }
+    }
+    else if (a < 0) {
+        if ((b > 0 && a < min / b) || (b < 0 && b < max / a)) {
+            return false;
+        }
+    }
+    res = a * b;
+    return true;
+}
+
+bool powerInteger(long base, long exponent, long& res)
+{
+    res = 1;
+    while (exponent > 0) {
+        if ((exponent & 1) != 0 && !multiplyInteger(res, base, res)) {
+            return false;
+        }
+        exponent >>= 1;
+        if (exponent > 0 && !multiplyInteger(base, base, base)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Python's float modulo, the result has the sign of the divisor.
+bool moduloFloat(double a, double b, double& res)
+{
+    if (b == 0.0) {
+        return false;
+    }
+    res = std::fmod(a, b);
+    if (res != 0.0) {
+        if ((b < 0) != (res < 0)) {
+            res += b;
+        }
+    }
+    else {
+        res = std::copysign(0.0, b);
+    }
+    return true;
+}
+
+// Python's float power, refusing the cases that raise or return a complex.
+bool powerFloat(double a, double b, double& res)
+{
+    if (!std::isfinite(a) || !std::isfinite(b)) {
+        return false;
+    }
+    if ((a == 0.0 && b < 0.0) || (a < 0.0 && b != std::floor(b))) {
+        return false;
+    }
+    res = std::pow(a, b);
+    return std::isfinite(res);
+}
+
+bool isSupportedFunction(int f)
+{
+    switch (f) {
+        case FunctionExpression::ABS:
+        case FunctionExpression::ACOS:
+        case FunctionExpression::ASIN:
+        case FunctionExpression::ATAN:
+        case FunctionExpression::ATAN2:
+        case FunctionExpression::CATH:
+        case FunctionExpression::CBRT:
+        case FunctionExpression::CEIL:
+        case FunctionExpression::COS:
+        case FunctionExpression::COSH:
+        case FunctionExpression::EXP:
+        case FunctionExpression::FLOOR:
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::LOG:
+        case FunctionExpression::LOG10:
+        case FunctionExpression::MOD:
+        case FunctionExpression::POW:
+        case FunctionExpression::ROUND:
+        case FunctionExpression::SIN:
+        case FunctionExpression::SINH:
+        case FunctionExpression::SQRT:
+        case FunctionExpression::TAN:
+        case FunctionExpression::TANH:
+        case FunctionExpression::TRUNC:
+        case FunctionExpression::NOT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+CompiledExpression::CompiledExpression() = default;
+
+CompiledExpression::~CompiledExpression() = default;
+
+unsigned long CompiledExpression::getGeneration(const Document* doc)
+{
+    // Any change that may alter how an object identifier is resolved starts
+    // a new generation of the affected document. Compiled references stay in
+    // the owner document, only document names may resolve differently.
+    static const bool connected = [] {
+        auto invalidate = [](const PropertyContainer* container) {
+            auto obj = freecad_cast<const DocumentObject*>(container);
+            if (obj && obj->getDocument()) {
+                obj->getDocument()->advanceNameGeneration();
+            }
+        };
+        auto& app = GetApplication();
+        app.signalNewObject.connect([invalidate](const DocumentObject& obj) {
+            invalidate(&obj);
+        });
+        app.signalDeletedObject.connect([invalidate](const DocumentObject& obj) {
+            invalidate(&obj);
+        });
+        app.signalRelabelObject.connect([invalidate](const DocumentObject& obj) {
+            invalidate(&obj);
+        });
+        app.signalNewDocument.connect([](const Document&, bool) {
+            invalidateAll();
+        });
+        app.signalRelabelDocument.connect([](const Document&) {
+            invalidateAll();
+        });
+        app.signalDeleteDocument.connect([](const Document&) {
+            invalidateAll();
+        });
+        app.signalAppendDynamicProperty.connect([invalidate](const Property& prop) {
+            invalidate(prop.getContainer());
+        });
+        app.signalRemoveDynamicProperty.connect([invalidate](const Property& prop) {
+            invalidate(prop.getContainer());
+        });
+        app.signalRenameDynamicProperty.connect([invalidate](const Property& prop, const char*) {
+            invalidate(prop.getContainer());
+        });
+        app.signalMoveDynamicProperty.connect(
+            [invalidate](const Property& prop, const DocumentObject& obj) {
+                invalidate(prop.getContainer());
+                invalidate(&obj);
+            });
+        app.signalAddedDynamicExtension.connect(
+            [invalidate](const ExtensionContainer& container, std::string) {
+                invalidate(&container);
+            });
+        return true;
+    }();
+    (void)connected;
+
+    return doc ? doc->getNameGeneration() : 0;
+}
+
+void CompiledExpression::invalidateAll()
+{
+    for (auto doc : GetApplication().getDocuments()) {
+        doc->advanceNameGeneration();
+    }
+}
+
+bool CompiledExpression::isValid() const
+{
+    return generation == getGeneration(owner->getDocument());
+}
+
+std::unique_ptr<CompiledExpression> CompiledExpression::compile(const Expression* expr)
+{
+    if (!expr || !expr->getOwner() || !expr->getOwner()->getDocument()) {
+        return {};
+    }
+
+    std::unique_ptr<CompiledExpression> res(new CompiledExpression);
+    res->generation = getGeneration(expr->getOwner()->getDocument());
+    res->owner = expr->getOwner();
+
+    Base::PyGILStateLocker lock;
+    try {
+        std::size_t depth = 0;
+        if (!res->compileNode(expr, depth) || depth != 1) {
+            return {};
+        }
+    }
+    catch (Base::Exception&) {
+        return {};
+    }
+    catch (Py::Exception& e) {
+        e.clear();
+        return {};
+    }
+    catch (std::exception&) {
+        return {};
+    }
+    return res;
+}
+
+bool CompiledExpression::emit(const Instruction& instruction, std::size_t& depth, std::size_t pops)
+{
+    if (depth < pops) {
+        return false;
+    }
+    depth -= pops;
+    switch (instruction.code) {
+        case OpCode::JumpIfFalse:
+        case OpCode::Jump:
+            break;
+        default:
+            ++depth;
+            break;
+    }
+    if (depth > MaxStackSize) {
+        return false;
+    }
+    code.push_back(instruction);
+    return true;
+}
+
+bool CompiledExpression::compileNode(const Expression* expr, std::size_t& depth)
+{
+    if (!expr || expr->hasComponent()) {
+        return false;
+    }
+
+    if (auto opExpr = freecad_cast<OperatorExpression*>(expr)) {
+        int op = opExpr->getOperator();
+        switch (op) {
+            case OperatorExpression::NEG:
+            case OperatorExpression::POS: {
+                Instruction instruction;
+                instruction.code = OpCode::Unary;
+                instruction.op = op;
+                return compileNode(opExpr->getLeft(), depth) && emit(instruction, depth, 1);
+            }
+            case OperatorExpression::ADD:
+            case OperatorExpression::SUB:
+            case OperatorExpression::MUL:
+            case OperatorExpression::DIV:
+            case OperatorExpression::MOD:
+            case OperatorExpression::POW:
+            case OperatorExpression::EQ:
+            case OperatorExpression::NEQ:
+            case OperatorExpression::LT:
+            case OperatorExpression::GT:
+            case OperatorExpression::LTE:
+            case OperatorExpression::GTE:
+            case OperatorExpression::UNIT: {
+                Instruction instruction;
+                instruction.code = OpCode::Binary;
+                instruction.op = op;
+                return compileNode(opExpr->getLeft(), depth)
+                    && compileNode(opExpr->getRight(), depth) && emit(instruction, depth, 2);
+            }
+            default:
+                return false;
+        }
+    }
+
+    if (auto condExpr = freecad_cast<ConditionalExpression*>(expr)) {
+        Instruction jumpIfFalse;
+        jumpIfFalse.code = OpCode::JumpIfFalse;
+        if (!compileNode(condExpr->getCondition(), depth) || !emit(jumpIfFalse, depth, 1)) {
+            return false;
+        }
+        std::size_t falseJump = code.size() - 1;
+        std::size_t base = depth;
+
+        Instruction jump;
+        jump.code = OpCode::Jump;
+        if (!compileNode(condExpr->getTrueExpression(), depth) || depth != base + 1
+            || !emit(jump, depth, 0)) {
+            return false;
+        }
+        std::size_t endJump = code.size() - 1;
+
+        code[falseJump].target = code.size();
+        depth = base;
+        if (!compileNode(condExpr->getFalseExpression(), depth) || depth != base + 1) {
+            return false;
+        }
+        code[endJump].target = code.size();
+        return true;
+    }
+
+    if (auto funcExpr = freecad_cast<FunctionExpression*>(expr)) {
+        const auto& args = funcExpr->getArgs();
+        if (!isSupportedFunction(funcExpr->getFunction()) || args.empty()) {
+            return false;
+        }
+        // Only the first three arguments are evaluated by the interpreter.
+        std::size_t count = std::min<std::size_t>(args.size(), 3);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!compileNode(args[i], depth)) {
+                return false;
+            }
+        }
+        Instruction instruction;
+        instruction.code = OpCode::Call;
+        instruction.op = funcExpr->getFunction();
+        instruction.target = count;
+        instruction.expr = funcExpr;
+        return emit(instruction, depth, count);
+    }
+
+    if (auto varExpr = freecad_cast<VariableExpression*>(expr)) {
+        return compileVariable(varExpr, depth);
+    }
+
+    if (expr->is<UnitExpression>() || expr->is<NumberExpression>()
+        || expr->is<ConstantExpression>()) {
+        return compileConstant(expr, depth);
+    }
+
+    return false;
+}
+
+bool CompiledExpression::compileConstant(const Expression* expr, std::size_t& depth)
+{
+    Py::Object pyobj = expr->getPyValue();
+    Value value;
+    if (PyObject_TypeCheck(pyobj.ptr(), &Base::QuantityPy::Type)) {
+        const auto* quantity = static_cast<Base::QuantityPy*>(pyobj.ptr())->getQuantityPtr();
+        value.kind = Kind::Quantity;
+        value.number = quantity->getValue();
+        value.unit = quantity->getUnit();
+    }
+    else if (PyFloat_Check(pyobj.ptr())) {
+        value.kind = Kind::Float;
+        value.number = PyFloat_AsDouble(pyobj.ptr());
+    }
+    else if (PyLong_Check(pyobj.ptr())) {
+        int overflow = 0;
+        value.kind = Kind::Integer;
+        value.integer = PyLong_AsLongAndOverflow(pyobj.ptr(), &overflow);
+        if (overflow != 0) {
+            return false;
+        }
+    }
+    else {
+        return false;
+    }
+
+    Instruction instruction;
+    instruction.code = OpCode::Push;
+    instruction.target = constants.size();
+    constants.push_back(value);
+    return emit(instruction, depth, 0);
+}
+
+bool CompiledExpression::compileVariable(const VariableExpression* expr, std::size_t& depth)
+{
+    ObjectIdentifier var = expr->getPath();
+    int ptype = 0;
+    Property* prop = var.getProperty(&ptype);
+    if (!prop || ptype != 0 || var.numSubComponents() != 1 || !var.getSubObjectName().empty()) {
+        return false;
+    }
+
+    // Only references inside the owner document are resolved, so that the
+    // result does not depend on the label of other documents.
+    DocumentObject* obj = var.getDocumentObject();
+    if (!obj || prop->getContainer() != obj || obj->getDocument() != owner->getDocument()) {
+        return false;
+    }
+
+    Instruction instruction;
+    instruction.prop = prop;
+    if (prop->isDerivedFrom<PropertyQuantity>()) {
+        instruction.code = OpCode::LoadQuantity;
+    }
+    else if (prop->isDerivedFrom<PropertyFloat>()) {
+        instruction.code = OpCode::LoadFloat;
+    }
+    else if (prop->isDerivedFrom<PropertyInteger>()) {
+        instruction.code = OpCode::LoadInteger;
+    }
+    else if (prop->isDerivedFrom<PropertyBool>()) {
+        instruction.code = OpCode::LoadBool;
+    }
+    else {
+        return false;
+    }
+
+    // Make sure the interpreter sees the same value, in case a derived
+    // property overrides its Python representation.
+    Value value;
+    load(instruction, value);
+    Py::Object pyobj = var.getPyValue(true);
+    switch (value.kind) {
+        case Kind::Quantity:
+            if (!PyObject_TypeCheck(pyobj.ptr(), &Base::QuantityPy::Type)
+                || *static_cast<Base::QuantityPy*>(pyobj.ptr())->getQuantityPtr()
+                    != Base::Quantity(value.number, value.unit)) {
+                return false;
+            }
+            break;
+        case Kind::Float:
+            if (!PyFloat_Check(pyobj.ptr()) || PyFloat_AsDouble(pyobj.ptr()) != value.number) {
+                return false;
+            }
+            break;
+        case Kind::Integer:
+            if (!PyLong_Check(pyobj.ptr()) || PyLong_AsLong(pyobj.ptr()) != value.integer) {
+                return false;
+            }
+            break;
+        case Kind::Boolean:
+            if (!PyBool_Check(pyobj.ptr()) || (pyobj.ptr() == Py_True) != (value.integer != 0)) {
+                return false;
+            }
+            break;
+    }
+
+    return emit(instruction, depth, 0);
+}
+
+bool CompiledExpression::load(const Instruction& instruction, Value& value)
+{
+    switch (instruction.code) {
+        case OpCode::LoadQuantity: {
+            auto prop = static_cast<const PropertyQuantity*>(instruction.prop);
+            value.kind = Kind::Quantity;
+            value.number = prop->getValue();
+            value.unit = prop->getUnit();
+            return true;
+        }
+        case OpCode::LoadFloat:
+            value.kind = Kind::Float;
+            value.number = static_cast<const PropertyFloat*>(instruction.prop)->getValue();
+            return true;
+        case OpCode::LoadInteger:
+            value.kind = Kind::Integer;
+            value.integer = static_cast<const PropertyInteger*>(instruction.prop)->getValue();
+            return true;
+        case OpCode::LoadBool:
+            value.kind = Kind::Boolean;
+            value.integer = static_cast<const PropertyBool*>(instruction.prop)->getValue() ? 1 : 0;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool CompiledExpression::unary(int op, Value& value)
+{
+    // Like in Python, arithmetic turns a boolean into an integer
+    if (value.kind == Kind::Boolean) {
+        value.kind = Kind::Integer;
+    }
+    if (op == OperatorExpression::POS) {
+        return true;
+    }
+    switch (value.kind) {
+        case Kind::Boolean:
+        case Kind::Integer:
+            if (value.integer == std::numeric_limits<long>::min()) {
+                return false;
+            }
+            value.integer = -value.integer;
+            return true;
+        case Kind::Float:
+            value.number = -value.number;
+            return true;
+        case Kind::Quantity:
+            value.number *= -1;
+            return true;
+    }
+    return false;
+}
+
+bool CompiledExpression::binary(int op, Value& left, Value right)
+{
+    // Like in Python, arithmetic and comparisons treat booleans as integers
+    if (left.kind == Kind::Boolean) {
+        left.kind = Kind::Integer;
+    }
+    if (right.kind == Kind::Boolean) {
+        right.kind = Kind::Integer;
+    }
+    if (op == OperatorExpression::UNIT) {
+        op = OperatorExpression::MUL;
+    }
+
+    if (left.kind == Kind::Quantity || right.kind == Kind::Quantity) {
+        auto toQuantity = [](const Value& v) {
+            switch (v.kind) {
+                case Kind::Integer:
+                    return Base::Quantity(static_cast<double>(v.integer));
+                case Kind::Float:
+                    return Base::Quantity(v.number);
+                default:
+                    return Base::Quantity(v.number, v.unit);
+            }
+        };
+        auto toDouble = [](const Value& v) {
+            return v.kind == Kind::Integer ? static_cast<double>(v.integer) : v.number;
+        };
+
+        Base::Quantity res;
+        try {
+            switch (op) {
+                case OperatorExpression::ADD:
+                    res = toQuantity(left) + toQuantity(right);
+                    break;
+                case OperatorExpression::SUB:
+                    res = toQuantity(left) - toQuantity(right);
+                    break;
+                case OperatorExpression::MUL:
+                    res = toQuantity(left) * toQuantity(right);
+                    break;
+                case OperatorExpression::DIV:
+                    res = toQuantity(left) / toQuantity(right);
+                    break;
+                case OperatorExpression::MOD: {
+                    double mod {};
+                    if (left.kind != Kind::Quantity || !moduloFloat(left.number, toDouble(right), mod)) {
+                        return false;
+                    }
+                    res = Base::Quantity(mod, left.unit);
+                    break;
+                }
+                case OperatorExpression::POW:
+                    if (left.kind != Kind::Quantity) {
+                        return false;
+                    }
+                    if (right.kind == Kind::Quantity) {
+                        res = toQuantity(left).pow(toQuantity(right));
+                    }
+                    else {
+                        res = toQuantity(left).pow(toDouble(right));
+                    }
+                    break;
+                default: {
+                    // Mixed comparisons go through float conversion in Python
+                    if (left.kind != Kind::Quantity || right.kind != Kind::Quantity) {
+                        return false;
+                    }
+                    Base::Quantity a = toQuantity(left);
+                    Base::Quantity b = toQuantity(right);
+                    bool cmp = false;
+                    switch (op) {
+                        case OperatorExpression::EQ:
+                            cmp = a == b;
+                            break;
+                        case OperatorExpression::NEQ:
+                            cmp = !(a == b);
+                            break;
+                        case OperatorExpression::LT:
+                            cmp = a < b;
+                            break;
+                        case OperatorExpression::LTE:
+                            cmp = a < b || a == b;
+                            break;
+                        case OperatorExpression::GT:
+                            cmp = !(a < b) && !(a == b);
+                            break;
+                        case OperatorExpression::GTE:
+                            cmp = !(a < b);
+                            break;
+                        default:
+                            return false;
+                    }
+                    left.kind = Kind::Boolean;
+                    left.integer = cmp ? 1 : 0;
+                    return true;
+                }
+            }
+        }
+        catch (Base::Exception&) {
+            // Unit mismatch or overflow, let the interpreter report it
+            return false;
+        }
+        left.kind = Kind::Quantity;
+        left.number = res.getValue();
+        left.unit = res.getUnit();
+        return true;
+    }
+
+    switch (op) {
+        case OperatorExpression::EQ:
+        case OperatorExpression::NEQ:
+        case OperatorExpression::LT:
+        case OperatorExpression::GT:
+        case OperatorExpression::LTE:
+        case OperatorExpression::GTE:
+            return compare(op, left, right);
+        default:
+            break;
+    }
+
+    if (left.kind == Kind::Integer && right.kind == Kind::Integer) {
+        long a = left.integer;
+        long b = right.integer;
+        switch (op) {
+            case OperatorExpression::ADD:
+                return addInteger(a, b, left.integer);
+            case OperatorExpression::SUB:
+                return subtractInteger(a, b, left.integer);
+            case OperatorExpression::MUL:
+                return multiplyInteger(a, b, left.integer);
+            case OperatorExpression::DIV:
+                // Python divides the exact integers
+                if (b == 0 || std::fabs(static_cast<double>(a)) > maxExactInteger
+                    || std::fabs(static_cast<double>(b)) > maxExactInteger) {
+                    return false;
+                }
+                left.kind = Kind::Float;
+                left.number = static_cast<double>(a) / static_cast<double>(b);
+                return true;
+            case OperatorExpression::MOD: {
+                if (b == 0) {
+                    return false;
+                }
+                long mod = b == -1 ? 0 : a % b;
+                if (mod != 0 && ((mod < 0) != (b < 0))) {
+                    mod += b;
+                }
+                left.integer = mod;
+                return true;
+            }
+            case OperatorExpression::POW:
+                if (b >= 0) {
+                    return powerInteger(a, b, left.integer);
+                }
+                left.kind = Kind::Float;
+                return powerFloat(static_cast<double>(a), static_cast<double>(b), left.number);
+            default:
+                return false;
+        }
+    }
+
+    double a = left.kind == Kind::Integer ? static_cast<double>(left.integer) : left.number;
+    double b = right.kind == Kind::Integer ? static_cast<double>(right.integer) : right.number;
+    left.kind = Kind::Float;
+    switch (op) {
+        case OperatorExpression::ADD:
+            left.number = a + b;
+            return true;
+        case OperatorExpression::SUB:
+            left.number = a - b;
+            return true;
+        case OperatorExpression::MUL:
+            left.number = a * b;
+            return true;
+        case OperatorExpression::DIV:
+            if (b == 0.0) {
+                return false;
+            }
+            left.number = a / b;
+            return true;
+        case OperatorExpression::MOD:
+            return moduloFloat(a, b, left.number);
+        case OperatorExpression::POW:
+            return powerFloat(a, b, left.number);
+        default:
+            return false;
+    }
+}
+
+bool CompiledExpression::compare(int op, Value& left, const Value& right)
+{
+    bool res = false;
+    if (left.kind == Kind::Integer && right.kind == Kind::Integer) {
+        long a = left.integer;
+        long b = right.integer;
+        switch (op) {
+            case OperatorExpression::EQ:
+                res = a == b;
+                break;
+            case OperatorExpression::NEQ:
+                res = a != b;
+                break;
+            case OperatorExpression::LT:
+                res = a < b;
+                break;
+            case OperatorExpression::GT:
+                res = a > b;
+                break;
+            case OperatorExpression::LTE:
+                res = a <= b;
+                break;
+            case OperatorExpression::GTE:
+                res = a >= b;
+                break;
+            default:
+                return false;
+        }
+    }
+    else {
+        // Python compares a mixed integer and float exactly
+        if ((left.kind == Kind::Integer
+             && std::fabs(static_cast<double>(left.integer)) > maxExactInteger)
+            || (right.kind == Kind::Integer
+                && std::fabs(static_cast<double>(right.integer)) > maxExactInteger)) {
+            return false;
+        }
+        double a = left.kind == Kind::Integer ? static_cast<double>(left.integer) : left.number;
+        double b = right.kind == Kind::Integer ? static_cast<double>(right.integer) : right.number;
+        switch (op) {
+            case OperatorExpression::EQ:
+                res = a == b;
+                break;
+            case OperatorExpression::NEQ:
+                res = a != b;
+                break;
+            case OperatorExpression::LT:
+                res = a < b;
+                break;
+            case OperatorExpression::GT:
+                res = a > b;
+                break;
+            case OperatorExpression::LTE:
+                res = a <= b;
+                break;
+            case OperatorExpression::GTE:
+                res = a >= b;
+                break;
+            default:
+                return false;
+        }
+    }
+    left.kind = Kind::Boolean;
+    left.integer = res ? 1 : 0;
+    return true;
+}
+
+bool CompiledExpression::call(const Instruction& instruction, Value* args)
+{
+    std::array<Base::Quantity, 3> values;
+    std::size_t count = std::min<std::size_t>(instruction.target, values.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        const Value& arg = args[i];
+        switch (arg.kind) {
+            case Kind::Boolean:
+            case Kind::Integer:
+                values[i] = Base::Quantity(static_cast<double>(arg.integer));
+                break;
+            case Kind::Float:
+                values[i] = Base::Quantity(arg.number);
+                break;
+            case Kind::Quantity:
+                values[i] = Base::Quantity(arg.number, arg.unit);
+                break;
+        }
+    }
+
+    Base::Quantity res;
+    try {
+        res = FunctionExpression::evaluateNumeric(instruction.expr,
+                                                  instruction.op,
+                                                  values.data(),
+                                                  count);
+    }
+    catch (Base::Exception&) {
+        return false;
+    }
+
+    Value& value = args[0];
+    value.kind = Kind::Quantity;
+    value.number = res.getValue();
+    value.unit = res.getUnit();
+    return true;
+}
+
+bool CompiledExpression::eval(App::any& value) const
+{
+    if (!isValid()) {
+        return false;
+    }
+
+    std::array<Value, MaxStackSize> stack;
+    std::size_t top = 0;
+    std::size_t pc = 0;
+    while (pc < code.size()) {
+        const Instruction& instruction = code[pc++];
+        switch (instruction.code) {
+            case OpCode::Push:
+                stack[top++] = constants[instruction.target];
+                break;
+            case OpCode::LoadQuantity:
+            case OpCode::LoadFloat:
+            case OpCode::LoadInteger:
+            case OpCode::LoadBool:
+                load(instruction, stack[top++]);
+                break;
+            case OpCode::Unary:
+                if (!unary(instruction.op, stack[top - 1])) {
+                    return false;
+                }
+                break;
+            case OpCode::Binary:
+                --top;
+                if (!binary(instruction.op, stack[top - 1], stack[top])) {
+                    return false;
+                }
+                break;
+            case OpCode::Call:
+                top -= instruction.target;
+                if (!call(instruction, &stack[top])) {
+                    return false;
+                }
+                ++top;
+                break;
+            case OpCode::JumpIfFalse: {
+                const Value& cond = stack[--top];
+                bool isTrue = cond.kind == Kind::Integer || cond.kind == Kind::Boolean
+                    ? cond.integer != 0
+                    : cond.number != 0.0;
+                if (!isTrue) {
+                    pc = instruction.target;
+                }
+                break;
+            }
+            case OpCode::Jump:
+                pc = instruction.target;
+                break;
+        }
+    }
+
+    const Value& res = stack[0];
+    switch (res.kind) {
+        case Kind::Integer:
+            value = App::any(res.integer);
+            break;
+        case Kind::Boolean:
+            value = App::any(res.integer != 0);
+            break;
+        case Kind::Float:
+            value = App::any(res.number);
+            break;
+        case Kind::Quantity:
+            value = App::any(Base::Quantity(res.number, res.unit));
+            break;
+    }
+    return true;
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Base/Unit.h>
+
+#include "Expression.h"
+
+namespace App
+{
+
+class Document;
+class Property;
+class VariableExpression;
+
+/**
+ * @brief A flattened form of a numeric expression.
+ *
+ * An expression is compiled into a list of instructions working on a fixed
+ * size value stack. Property references are resolved once when compiling, and
+ * evaluating the compiled form neither allocates memory nor needs the Python
+ * interpreter.
+ *
+ * Only a subset of the expression syntax is supported: numbers, units and
+ * constants, the arithmetic and comparison operators, the conditional
+ * operator, the numeric functions and references to a float, quantity,
+ * integer or boolean property of an object in the same document. compile()
+ * returns nullptr for any other expression.
+ *
+ * The values follow the Python semantic of Expression::getValueAsAny(). In
+ * case of doubt, e.g. on integer overflow or on an evaluation error, eval()
+ * fails and the caller is expected to fall back to the interpreter, which
+ * reports the error or computes the exact result.
+ *
+ * Comparisons evaluate to a bool, arithmetic on booleans to an integer.
+ *
+ * The resolved property pointers are guarded by the name generation of the
+ * owner document, see Document::getNameGeneration(). A compiled form built
+ * in an older generation refuses to evaluate and has to be compiled again.
+ */
+class AppExport CompiledExpression
+{
+public:
+    /// The maximum depth of the value stack.
+    static constexpr std::size_t MaxStackSize = 64;
+
+    ~CompiledExpression();
+
+    CompiledExpression(const CompiledExpression&) = delete;
+    CompiledExpression(CompiledExpression&&) = delete;
+    CompiledExpression& operator=(const CompiledExpression&) = delete;
+    CompiledExpression& operator=(CompiledExpression&&) = delete;
+
+    /**
+     * @brief Compile an expression.
+     *
+     * @param[in] expr The expression to compile.
+     * @return The compiled form, or nullptr if the expression is not supported.
+     */
+    static std::unique_ptr<CompiledExpression> compile(const Expression* expr);
+
+    /**
+     * @brief Evaluate the compiled expression.
+     *
+     * @param[out] value The result, of the same type as returned by
+     * Expression::getValueAsAny().
+     * @return False if the expression must be evaluated by the interpreter
+     * instead.
+     */
+    bool eval(App::any& value) const;
+
+    /// Check if the resolved property references are still valid.
+    bool isValid() const;
+
+    /// The number of instructions.
+    std::size_t size() const
+    {
+        return code.size();
+    }
+
+    /// The current generation of property references in a document.
+    static unsigned long getGeneration(const Document* doc);
+    /// Invalidate all compiled expressions.
+    static void invalidateAll();
+
+private:
+    CompiledExpression();
+
+    enum class Kind : std::uint8_t
+    {
+        Integer,
+        Boolean,
+        Float,
+        Quantity
+    };
+
+    struct Value
+    {
+        Kind kind {Kind::Integer};
+        long integer {0};
+        double number {0.0};
+        Base::Unit unit;
+    };
+
+    enum class OpCode : std::uint8_t
+    {
+        Push,
+        LoadQuantity,
+        LoadFloat,
+        LoadInteger,
+        LoadBool,
+        Unary,
+        Binary,
+        Call,
+        JumpIfFalse,
+        Jump
+    };
+
+    struct Instruction
+    {
+        OpCode code {OpCode::Push};
+        int op {0};                        /**< Operator or function */
+        std::size_t target {0};            /**< Constant index, jump target or argument count */
+        const Property* prop {nullptr};    /**< Property to load */
+        const Expression* expr {nullptr};  /**< Function expression for error messages */
+    };
+
+    bool compileNode(const Expression* expr, std::size_t& depth);
+    bool compileConstant(const Expression* expr, std::size_t& depth);
+    bool compileVariable(const VariableExpression* expr, std::size_t& depth);
+    bool emit(const Instruction& instruction, std::size_t& depth, std::size_t pops);
+
+    static bool load(const Instruction& instruction, Value& value);
+    static bool unary(int op, Value& value);
+    static bool binary(int op, Value& left, Value right);
+    static bool compare(int op, Value& left, const Value& right);
+    static bool call(const Instruction& instruction, Value* args);
+
+    std::vector<Instruction> code;
+    std::vector<Value> constants;
+    const DocumentObject* owner {nullptr};
+    unsigned long generation {0};
+};
+
+}  // namespace App
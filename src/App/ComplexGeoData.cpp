@@ -234,6 +234,14 @@ size_t ComplexGeoData::getElementMapSize(bool flush) const
     return _elementMap ? _elementMap->size() : 0;
 }
 
+void ComplexGeoData::compactElementMap()
+{
+    flushElementMap();
+    if (_elementMap && _elementMap.use_count() == 1) {
+        _elementMap->compact();
+    }
+}
+
 MappedName ComplexGeoData::getMappedName(const IndexedName& element,
                                          bool allowUnmapped,
                                          ElementIDRefs* sid) const
@@ -673,16 +681,20 @@ void ComplexGeoData::RestoreDocFile(Base::Reader& reader)
     restoreStream(reader, static_cast<std::size_t>(count));
 }
 
-unsigned int ComplexGeoData::getMemSize() const
+size_t ComplexGeoData::getElementMapMemSize() const
 {
     flushElementMap();
     if (_elementMap) {
-        static const int multiplier {10};
-        return _elementMap->size() * multiplier;
+        return _elementMap->getMemSize();
     }
     return 0;
 }
 
+unsigned int ComplexGeoData::getMemSize() const
+{
+    return static_cast<unsigned int>(getElementMapMemSize());
+}
+
 std::vector<IndexedName> ComplexGeoData::getHigherElements(const char*, bool) const
 {
     return {};
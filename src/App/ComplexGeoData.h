@@ -549,6 +549,9 @@ public:
     /// Get the current element map size.
     size_t getElementMapSize(bool flush = true) const;
 
+    /// Get the memory used by the element map in bytes.
+    size_t getElementMapMemSize() const;
+
     /**
      * @brief Get the higher level element names of the given element.
      *
@@ -587,6 +590,12 @@ public:
 
     /// Flush internal buffers for element mapping.
     virtual void flushElementMap() const;
+
+    /** Switch the element map to its compact representation, see ElementMap::compact().
+     * Does nothing while the map is shared with other data, which may be
+     * reading it on another thread.
+     */
+    void compactElementMap();
     /// @}
 
     /**
@@ -22,10 +22,12 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <bitset>
 #include <stack>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <utility>
 #include <set>
 #include <memory>
@@ -35,9 +37,11 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <condition_variable>
 #include <filesystem>
 #include <format>
 #include <optional>
+#include <thread>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/bimap.hpp>
@@ -75,11 +79,15 @@
 #include "Application.h"
 #include "AutoTransaction.h"
 #include "BackupPolicy.h"
+#include "ComplexGeoData.h"
 #include "ExpressionParser.h"
 #include "GeoFeature.h"
 #include "License.h"
 #include "Link.h"
 #include "MergeDocuments.h"
+#include "ParallelRestore.h"
+#include "PropertyGeo.h"
+#include "PropertyPythonObject.h"
 #include "StringHasher.h"
 #include "Transactions.h"
 
@@ -116,6 +124,139 @@ bool transactionStateBlocksRecoveryWrite(const DocumentP& documentPrivate)
         || documentPrivate.activeUndoTransaction != nullptr || documentPrivate.committing;
 }
 
+// Threads kept between the calls of runConcurrently(), so that a recompute
+// does not start new threads for each wave of objects.
+class WorkerPool
+{
+public:
+    static WorkerPool& instance()
+    {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void run(std::size_t count,
+             unsigned int maxThreads,
+             const std::function<void(std::size_t)>& task)
+    {
+        Batch batch {count, task};
+        const std::size_t threadCount = std::min<std::size_t>(maxThreads, count);
+        if (threadCount > 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (threads.size() < threadCount - 1) {
+                threads.emplace_back(&WorkerPool::work, this);
+            }
+            queue.insert(queue.end(), threadCount - 1, &batch);
+            wake.notify_all();
+        }
+        batch.run();
+
+        // Tasks not started yet are not needed anymore. Not waiting for them
+        // also keeps a nested call from a pool thread from blocking the pool.
+        std::unique_lock<std::mutex> lock(mutex);
+        std::erase(queue, &batch);
+        done.wait(lock, [&batch]() {
+            return batch.running == 0;
+        });
+    }
+
+private:
+    struct Batch
+    {
+        std::size_t count;
+        const std::function<void(std::size_t)>& task;
+        std::atomic<std::size_t> next {0};
+        // pool threads working on the batch, guarded by WorkerPool::mutex
+        int running {0};
+
+        void run()
+        {
+            for (std::size_t i = next++; i < count; i = next++) {
+                task(i);
+            }
+        }
+    };
+
+    WorkerPool() = default;
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this]() {
+                return stop || !queue.empty();
+            });
+            if (stop) {
+                return;
+            }
+            auto batch = queue.front();
+            queue.pop_front();
+            ++batch->running;
+            lock.unlock();
+            batch->run();
+            lock.lock();
+            if (--batch->running == 0) {
+                done.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::deque<Batch*> queue;
+    std::vector<std::thread> threads;
+    bool stop {false};
+};
+
+// Run task(0) ... task(count - 1) on up to maxThreads threads, including the
+// calling one, and return when all of them have finished.
+void runConcurrently(std::size_t count,
+                     unsigned int maxThreads,
+                     const std::function<void(std::size_t)>& task)
+{
+    WorkerPool::instance().run(count, maxThreads, task);
+}
+
+// Group objects of a topologically sorted list into waves, so that an object
+// only depends on objects of earlier waves. Objects within one wave are
+// independent of each other and keep their relative order.
+std::vector<std::vector<DocumentObject*>> groupIntoWaves(const std::vector<DocumentObject*>& objs)
+{
+    std::vector<std::vector<DocumentObject*>> waves;
+    std::unordered_map<const DocumentObject*, std::size_t> waveOf;
+    for (auto obj : objs) {
+        std::size_t wave = 0;
+        for (auto dep : obj->getOutList()) {
+            auto it = waveOf.find(dep);
+            if (it != waveOf.end()) {
+                wave = std::max(wave, it->second + 1);
+            }
+        }
+        waveOf[obj] = wave;
+        if (wave >= waves.size()) {
+            waves.resize(wave + 1);
+        }
+        waves[wave].push_back(obj);
+    }
+    return waves;
+}
+
 }  // namespace
 
 namespace App
@@ -570,6 +711,111 @@ void Document::_clearRedos()
     }
 }
 
+void Document::beginBulkUpdate()
+{
+    ++d->bulkUpdateDepth;
+}
+
+void Document::endBulkUpdate()
+{
+    if (d->bulkUpdateDepth == 0) {
+        FC_WARN("No bulk update of document " << getName() << " to end");
+        return;
+    }
+    if (--d->bulkUpdateDepth == 0) {
+        _flushBulkUpdate();
+    }
+}
+
+bool Document::isBulkUpdating() const
+{
+    return d->bulkUpdateDepth > 0;
+}
+
+bool Document::_deferChangeSignal(const PropertyContainer* container,
+                                  const Property* prop,
+                                  bool before)
+{
+    if (d->bulkUpdateDepth == 0) {
+        return false;
+    }
+    auto& pending = d->bulkUpdate;
+    // A new object is signaled in its final state
+    if (container != this
+        && pending.newObjectSet.contains(static_cast<const DocumentObject*>(container))) {
+        return true;
+    }
+    if (pending.changeSet.contains(prop)) {
+        return true;
+    }
+    if (before) {
+        return false;
+    }
+    const char* name = prop->getName();
+    if (!name) {
+        return false;
+    }
+    pending.changeSet.insert(prop);
+    pending.changes.push_back({container, prop, name});
+    return true;
+}
+
+void Document::_flushBulkUpdate()
+{
+    // Signal handlers may change the document again, so take the pending
+    // signals first. Anything they change is signaled immediately.
+    while (!d->bulkUpdate.empty()) {
+        DocumentP::BulkUpdate pending;
+        std::swap(pending, d->bulkUpdate);
+
+        for (const auto& entry : pending.newObjects) {
+            signalNewObject(*entry.object);
+            if (entry.transaction
+                && (entry.transaction == d->activeUndoTransaction
+                    || std::ranges::find(mUndoTransactions, entry.transaction)
+                        != mUndoTransactions.end())) {
+                signalTransactionAppend(*entry.object, entry.transaction);
+            }
+        }
+        if (pending.activatedObject && pending.activatedObject == d->activeObject) {
+            signalActivatedObject(*pending.activatedObject);
+        }
+        for (const auto& change : pending.changes) {
+            if (change.container == this) {
+                if (getPropertyByName(change.name.c_str()) == change.prop) {
+                    signalChanged(*this, *change.prop);
+                }
+                continue;
+            }
+            auto obj = static_cast<const DocumentObject*>(change.container);
+            if (pending.newObjectSet.contains(obj)
+                || obj->getPropertyByName(change.name.c_str()) != change.prop) {
+                continue;
+            }
+            signalChangedObject(*obj, *change.prop);
+        }
+    }
+}
+
+BulkUpdateGuard::BulkUpdateGuard(Document* doc)
+    : doc(doc)
+{
+    doc->beginBulkUpdate();
+}
+
+BulkUpdateGuard::~BulkUpdateGuard()
+{
+    try {
+        doc->endBulkUpdate();
+    }
+    catch (Base::Exception& e) {
+        e.reportException();
+    }
+    catch (...) {
+        FC_ERR("Unknown exception on ending bulk update");
+    }
+}
+
 void Document::commitTransaction() // NOLINT
 {
     if (isPerformingTransaction() || d->committing) {
@@ -617,11 +863,7 @@ bool Document::_commitTransaction(const bool notify)
             d->activeUndoTransaction = nullptr;
 
             // check the stack for the limits
-            if (mUndoTransactions.size() > d->UndoMaxStackSize) {
-                mUndoMap.erase(mUndoTransactions.front()->getID());
-                delete mUndoTransactions.front();
-                mUndoTransactions.pop_front();
-            }
+            _checkUndoLimits();
             signalCommitTransaction(*this);
 
             // commitTransaction() may call again _commitTransaction()
@@ -734,6 +976,7 @@ bool Document::isTransactionEmpty() const
 void Document::clearDocument() // NOLINT
 {
     d->activeObject = nullptr;
+    d->bulkUpdate = {};
 
     if (!d->objectArray.empty()) {
         GetApplication().signalDeleteDocument(*this);
@@ -746,6 +989,7 @@ void Document::clearDocument() // NOLINT
     setStatus(Document::PartialDoc, false);
 
     d->clearRecomputeLog();
+    d->recomputeCache.clear();
     d->objectLabelManager.clear();
     d->objectArray.clear();
     d->objectMap.clear();
@@ -830,14 +1074,75 @@ int Document::getAvailableRedos(const int id) const
     return static_cast<int>(mRedoTransactions.size());
 }
 
+RecomputeCache& Document::getRecomputeCache() const
+{
+    return d->recomputeCache;
+}
+
+RecomputeProfiler& Document::getRecomputeProfiler() const
+{
+    return d->recomputeProfiler;
+}
+
+unsigned long Document::getNameGeneration() const
+{
+    return d->nameGeneration.load(std::memory_order_acquire);
+}
+
+void Document::advanceNameGeneration()
+{
+    d->nameGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
 unsigned int Document::getUndoMemSize() const
 {
-    return d->UndoMemSize;
+    unsigned int size = 0;
+    for (const auto transaction : mUndoTransactions) {
+        size += transaction->getMemSize();
+    }
+    for (const auto transaction : mRedoTransactions) {
+        size += transaction->getMemSize();
+    }
+    if (d->activeUndoTransaction) {
+        size += d->activeUndoTransaction->getMemSize();
+    }
+    return size;
 }
 
 void Document::setUndoLimit(const unsigned int UndoMemSize) // NOLINT
 {
-    d->UndoMemSize = UndoMemSize;
+    d->UndoMemLimit = UndoMemSize;
+    _checkUndoLimits();
+}
+
+unsigned int Document::getUndoLimit() const
+{
+    return d->UndoMemLimit;
+}
+
+void Document::_checkUndoLimits()
+{
+    while (mUndoTransactions.size() > d->UndoMaxStackSize) {
+        mUndoMap.erase(mUndoTransactions.front()->getID());
+        delete mUndoTransactions.front();
+        mUndoTransactions.pop_front();
+    }
+
+    if (d->UndoMemLimit == 0) {
+        return;
+    }
+    // Drop the oldest transactions until the memory budget is met, but always
+    // keep the last one so that the most recent change can be undone.
+    unsigned int size = getUndoMemSize();
+    while (size > d->UndoMemLimit && mUndoTransactions.size() > 1) {
+        Transaction* transaction = mUndoTransactions.front();
+        size -= std::min(size, transaction->getMemSize());
+        FC_LOG("Drop undo transaction '" << transaction->Name << "' of " << getName()
+                                         << " because of the memory limit");
+        mUndoMap.erase(transaction->getID());
+        delete transaction;
+        mUndoTransactions.pop_front();
+    }
 }
 
 void Document::setMaxUndoStackSize(const unsigned int UndoMaxStackSize) // NOLINT
@@ -855,12 +1160,16 @@ void Document::onBeforeChange(const Property* prop)
     if (prop == &Label) {
         oldLabel = Label.getValue();
     }
-    signalBeforeChange(*this, *prop);
+    if (!_deferChangeSignal(this, prop, true)) {
+        signalBeforeChange(*this, *prop);
+    }
 }
 
 void Document::onChanged(const Property* prop)
 {
-    signalChanged(*this, *prop);
+    if (!_deferChangeSignal(this, prop, false)) {
+        signalChanged(*this, *prop);
+    }
 
     // the Name property is a label for display purposes
     if (prop == &Label) {
@@ -922,7 +1231,10 @@ void Document::onChanged(const Property* prop)
 
 void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Property* What)
 {
-    if (Who->isDerivedFrom<DocumentObject>()) {
+    auto lock = d->lockConcurrentRecompute();
+    if (Who->isDerivedFrom<DocumentObject>()
+        && !_deferConcurrentChange(static_cast<const DocumentObject*>(Who), What, true)
+        && !_deferChangeSignal(Who, What, true)) {
         signalBeforeChangeObject(*static_cast<const DocumentObject*>(Who), *What);
     }
     if (!d->rollback && !globalIsRelabeling && !d->definingTransaction) {
@@ -935,7 +1247,43 @@ void Document::onBeforeChangeProperty(const TransactionalObject* Who, const Prop
 
 void Document::onChangedProperty(const DocumentObject* Who, const Property* What)
 {
-    signalChangedObject(*Who, *What);
+    auto lock = d->lockConcurrentRecompute();
+    d->savedFiles.erase(What);
+    if (!_deferConcurrentChange(Who, What, false) && !_deferChangeSignal(Who, What, false)) {
+        signalChangedObject(*Who, *What);
+    }
+}
+
+bool Document::_deferConcurrentChange(const DocumentObject* obj, const Property* prop, bool before)
+{
+    // The document signals may call into the GUI, which is only possible from
+    // the main thread, so they are emitted after the concurrent recompute.
+    if (!d->concurrentRecompute) {
+        return false;
+    }
+    if (const char* name = prop->getName()) {
+        d->concurrentChanges.push_back({obj, prop, name, before});
+    }
+    return true;
+}
+
+void Document::_flushConcurrentChanges()
+{
+    std::vector<DocumentP::ConcurrentChange> changes;
+    std::swap(changes, d->concurrentChanges);
+    for (const auto& change : changes) {
+        if (!change.object->isAttachedToDocument()
+            || change.object->getPropertyByName(change.name.c_str()) != change.prop
+            || _deferChangeSignal(change.object, change.prop, change.before)) {
+            continue;
+        }
+        if (change.before) {
+            signalBeforeChangeObject(*change.object, *change.prop);
+        }
+        else {
+            signalChangedObject(*change.object, *change.prop);
+        }
+    }
 }
 
 void Document::setTransactionMode(const int iMode) // NOLINT
@@ -1253,6 +1601,50 @@ void DocumentP::checkStringHasher(const Base::XMLReader& reader)
     }
 }
 
+void DocumentP::recordSavedFiles(
+    const Document* doc,
+    const std::string& archive,
+    const std::vector<std::pair<std::string, const Base::Persistence*>>& files
+)
+{
+    savedFiles.clear();
+    savedArchive = archive;
+    savedArchiveTime = Base::FileInfo(archive).lastModified();
+
+    // Only geometry data is considered. Its changes are always notified
+    // and the written file depends on nothing else than the value.
+    for (const auto& [fileName, object] : files) {
+        auto prop = freecad_cast<const PropertyComplexGeoData*>(object);
+        if (!prop) {
+            continue;
+        }
+        auto obj = freecad_cast<DocumentObject*>(prop->getContainer());
+        if (!obj || obj->getDocument() != doc || !prop->getName()) {
+            continue;
+        }
+        savedFiles[prop] = SavedFile {fileName, obj->getID(), prop->getName()};
+    }
+}
+
+std::map<const Base::Persistence*, std::string> DocumentP::getSavedFiles(const Document* doc) const
+{
+    std::map<const Base::Persistence*, std::string> files;
+    for (const auto& [prop, saved] : savedFiles) {
+        // The property may have been deleted in the meantime and its memory
+        // reused, so check that it is still the same one
+        auto obj = doc->getObjectByID(saved.objectID);
+        if (!obj || obj->getPropertyByName(saved.propertyName.c_str()) != prop) {
+            continue;
+        }
+        // Changes to frozen objects are not notified
+        if (obj->isFreezed()) {
+            continue;
+        }
+        files.emplace(prop, saved.fileName);
+    }
+    return files;
+}
+
 std::pair<bool, int> Document::addStringHasher(const StringHasherRef& hasher) const
 {
     if (!hasher) {
@@ -1709,6 +2101,15 @@ std::vector<DocumentObject*> Document::readObjects(Base::XMLReader& reader)
     reader.clearPartialRestoreDocumentObject();
     reader.readElement("ObjectData");
     Cnt = static_cast<int>(reader.getAttribute<long>("Count"));
+
+    // Properties that can be restored concurrently are only recorded while
+    // reading the objects, and restored once all objects have been read.
+    const unsigned int restoreThreads = GetApplication().getRestoreThreadCount();
+    std::optional<ParallelRestore> parallelRestore;
+    if (restoreThreads > 1) {
+        parallelRestore.emplace(reader);
+    }
+
     for (int i = 0; i < Cnt; i++) {
         reader.readElement("Object");
         std::string name = reader.getName(reader.getAttribute<const char*>("name"));
@@ -1751,6 +2152,13 @@ std::vector<DocumentObject*> Document::readObjects(Base::XMLReader& reader)
     }
     reader.readEndElement("ObjectData");
 
+    if (parallelRestore) {
+        runConcurrently(parallelRestore->size(), restoreThreads, [&](std::size_t index) {
+            parallelRestore->restore(index);
+        });
+        parallelRestore->apply(reader);
+    }
+
     return objs;
 }
 
@@ -1763,6 +2171,26 @@ void Document::addRecomputeObject(DocumentObject* obj) // NOLINT
     }
 }
 
+// Give an imported object a new UUID and remember the one of its source
+static void renewObjectUuid(DocumentObject* obj)
+{
+    if (const auto propUUID = freecad_cast<PropertyUUID*>(obj->getPropertyByName("_ObjectUUID"))) {
+        auto propSource = freecad_cast<PropertyUUID*>(obj->getPropertyByName("_SourceUUID"));
+        if (!propSource) {
+            propSource = static_cast<PropertyUUID*>(
+                obj->addDynamicProperty("App::PropertyUUID",
+                                        "_SourceUUID",
+                                        nullptr,
+                                        nullptr,
+                                        Prop_Output | Prop_Hidden));
+        }
+        if (propSource) {
+            propSource->setValue(propUUID->getValue());
+        }
+        propUUID->setValue(Base::Uuid::createUuid());
+    }
+}
+
 std::vector<DocumentObject*> Document::importObjects(Base::XMLReader& reader)
 {
     d->hashers.clear();
@@ -1791,23 +2219,7 @@ std::vector<DocumentObject*> Document::importObjects(Base::XMLReader& reader)
         if (o && o->isAttachedToDocument()) {
             o->setStatus(ObjImporting, true);
             FC_LOG("importing " << o->getFullName());
-            if (const auto propUUID =
-                    freecad_cast<PropertyUUID*>(o->getPropertyByName("_ObjectUUID"))) {
-                auto propSource =
-                    freecad_cast<PropertyUUID*>(o->getPropertyByName("_SourceUUID"));
-                if (!propSource) {
-                    propSource = static_cast<PropertyUUID*>(
-                        o->addDynamicProperty("App::PropertyUUID",
-                                              "_SourceUUID",
-                                              nullptr,
-                                              nullptr,
-                                              Prop_Output | Prop_Hidden));
-                }
-                if (propSource) {
-                    propSource->setValue(propUUID->getValue());
-                }
-                propUUID->setValue(Base::Uuid::createUuid());
-            }
+            renewObjectUuid(o);
         }
     }
 
@@ -1828,24 +2240,62 @@ std::vector<DocumentObject*> Document::importObjects(Base::XMLReader& reader)
     return objs;
 }
 
+std::size_t DocumentMemoryUsage::total() const
+{
+    std::size_t size = documentProperties + undo + redo + stringHasher + recomputeCache;
+    for (const auto& [name, objectSize] : objects) {
+        size += objectSize;
+    }
+    return size;
+}
+
 unsigned int Document::getMemSize() const
 {
-    unsigned int size = 0;
+    auto size = getMemoryUsage().total();
+    return static_cast<unsigned int>(
+        std::min<std::size_t>(size, std::numeric_limits<unsigned int>::max()));
+}
 
-    // size of the DocObjects in the document
-    for (const auto & it : d->objectArray) {
-        size += it->getMemSize();
-    }
+DocumentMemoryUsage Document::getMemoryUsage() const
+{
+    DocumentMemoryUsage usage;
 
-    size += d->Hasher->getMemSize();
+    std::vector<Property*> props;
+    for (const auto obj : d->objectArray) {
+        props.clear();
+        obj->getPropertyList(props);
+        std::size_t objectSize = 0;
+        for (const auto prop : props) {
+            std::size_t size = prop->getMemSize();
+            objectSize += size;
+            usage.propertyTypes[std::string(prop->getTypeId().getName())] += size;
+            // Measuring must not read postponed data, whose size getMemSize()
+            // already includes
+            auto geoProp = freecad_cast<PropertyComplexGeoData*>(prop);
+            if (geoProp && !geoProp->hasPendingLazyFile()) {
+                if (auto data = geoProp->getComplexData()) {
+                    usage.elementMaps += data->getElementMapMemSize();
+                }
+            }
+        }
+        usage.objects[obj->getNameInDocument()] = objectSize;
+    }
 
-    // size of the document properties...
-    size += PropertyContainer::getMemSize();
+    usage.documentProperties = PropertyContainer::getMemSize();
+    usage.stringHasher = d->Hasher->getMemSize();
+    usage.recomputeCache = d->recomputeCache.getMemSize();
 
-    // Undo Redo size
-    size += getUndoMemSize();
+    for (const auto transaction : mUndoTransactions) {
+        usage.undo += transaction->getMemSize();
+    }
+    if (d->activeUndoTransaction) {
+        usage.undo += d->activeUndoTransaction->getMemSize();
+    }
+    for (const auto transaction : mRedoTransactions) {
+        usage.redo += transaction->getMemSize();
+    }
 
-    return size;
+    return usage;
 }
 
 static std::string checkFileName(const char* file)
@@ -1955,6 +2405,7 @@ bool Document::save()
 
 bool Document::saveToFile(const char* filename) const
 {
+    const_cast<Document*>(this)->_flushBulkUpdate();  // NOLINT
     signalStartSave(*this, filename);
 
     auto hGrp = GetApplication().GetParameterGroupByPath(
@@ -2015,6 +2466,57 @@ bool Document::saveToFile(const char* filename) const
     }
 
 
+    // Postponed data must be read before the file it comes from is replaced.
+    // Data of properties that get written is read by SaveDocFile() anyway and
+    // entries copied unchanged are read from the new file afterwards, so
+    // unless the file is overwritten in place this is deferred until the
+    // new file is complete.
+    std::map<std::string, bool> replacedArchives;
+    auto isReplaced = [&](const std::string& archive) {
+        auto res = replacedArchives.emplace(archive, false);
+        if (res.second) {
+            res.first->second = canonical_path(archive.c_str()) == nativePath;
+        }
+        return res.first->second;
+    };
+    std::vector<std::shared_ptr<Base::LazyDocFile>> lazyFiles;
+    for (const auto& lazyFile : d->lazyFiles) {
+        auto file = lazyFile.lock();
+        if (!file || file->isLoaded() || !isReplaced(file->getArchiveName())) {
+            continue;
+        }
+        if (!policy) {
+            file->load();
+        }
+        else {
+            lazyFiles.push_back(std::move(file));
+        }
+    }
+
+    // Copy the files of unchanged properties from the archive they were last
+    // saved to, unless that is the file about to be overwritten in place
+    std::shared_ptr<zipios::ZipFile> previousArchive;
+    std::map<const Base::Persistence*, std::string> previousFiles;
+    const bool incremental = GetApplication().isIncrementalSaveEnabled();
+    if (incremental && !d->savedFiles.empty() && canonical_path(d->savedArchive.c_str()) != fn) {
+        Base::FileInfo archive(d->savedArchive);
+        // the file must not have been modified by somebody else
+        if (archive.exists() && archive.lastModified() == d->savedArchiveTime) {
+            try {
+                auto zipFile = std::make_shared<zipios::ZipFile>(archive.filePath());
+                if (zipFile->isValid()) {
+                    previousArchive = zipFile;
+                    previousFiles = d->getSavedFiles(this);
+                }
+            }
+            catch (const std::exception& e) {
+                FC_WARN("Cannot copy data from " << archive.filePath() << ": " << e.what());
+            }
+        }
+    }
+    std::vector<std::pair<std::string, const Base::Persistence*>> savedFiles;
+    std::map<std::string, std::string> copiedFiles;
+
     // open extra scope to close ZipWriter properly
     {
         Base::FileInfo tmp(fn);
@@ -2027,6 +2529,8 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setThreadCount(GetApplication().getSaveThreadCount());
+        writer.setPreviousFiles(previousArchive, std::move(previousFiles));
         writer.putNextEntry("Document.xml");
 
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
@@ -2052,9 +2556,31 @@ bool Document::saveToFile(const char* filename) const
             message << writer.getErrors().front();
             throw Base::FileException(message.str().c_str(), tmp);
         }
+        if (writer.getCopiedFileCount() > 0) {
+            FC_LOG("Copied " << writer.getCopiedFileCount() << " unchanged files");
+        }
+        savedFiles = writer.getFiles();
+        if (previousArchive && isReplaced(d->savedArchive)) {
+            copiedFiles = writer.getCopiedFiles();
+        }
 
         GetApplication().signalSaveDocument(*this);
     }
+    previousArchive.reset();
+
+    std::vector<std::pair<std::shared_ptr<Base::LazyDocFile>, std::string>> relocatedFiles;
+    for (const auto& file : lazyFiles) {
+        if (file->isLoaded()) {
+            continue;
+        }
+        auto it = copiedFiles.find(file->getFileName());
+        if (it != copiedFiles.end()) {
+            relocatedFiles.emplace_back(file, it->second);
+        }
+        else {
+            file->load();
+        }
+    }
 
     if (policy) {
         // if saving the project data succeeded rename to the actual file name
@@ -2089,6 +2615,34 @@ bool Document::saveToFile(const char* filename) const
         backupPolicy.apply(fn, nativePath);
     }
 
+    if (!relocatedFiles.empty()) {
+        try {
+            auto archive = std::make_shared<zipios::ZipFile>(nativePath);
+            for (auto& [file, fileName] : relocatedFiles) {
+                file->relocate(archive, std::move(fileName));
+            }
+        }
+        catch (const std::exception& e) {
+            FC_ERR("Cannot read postponed data from " << nativePath << ": " << e.what());
+        }
+    }
+    d->lazyFiles.erase(
+        std::remove_if(
+            d->lazyFiles.begin(),
+            d->lazyFiles.end(),
+            [](const std::weak_ptr<Base::LazyDocFile>& lazyFile) {
+                auto file = lazyFile.lock();
+                return !file || file->isLoaded();
+            }
+        ),
+        d->lazyFiles.end()
+    );
+
+    // A copy saved somewhere else does not become the document's archive
+    if (incremental && canonical_path(FileName.getValue()) == nativePath) {
+        d->recordSavedFiles(this, nativePath, savedFiles);
+    }
+
     signalFinishSave(*this, filename);
 
     return true;
@@ -2181,6 +2735,16 @@ void Document::restore(const char* filename,
         throw Base::FileException("Error reading compression file", filename);
     }
 
+    // Postponed data is read again from the archive later on, so only do
+    // this if it is the document file itself and not e.g. a recovery file
+    const bool isDocumentFile = fi.filePath() == Base::FileInfo(FileName.getValue()).filePath();
+    d->lazyFiles.clear();
+    d->savedFiles.clear();
+    d->savedArchive.clear();
+    if (GetApplication().isLazyRestoreEnabled() && isDocumentFile) {
+        reader.setLazyRestore(true);
+    }
+
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
 
@@ -2205,6 +2769,16 @@ void Document::restore(const char* filename,
     // without GUI. But if available then follow after all data files of the App document.
     signalRestoreDocument(reader);
     reader.readFiles(zipstream);
+    d->lazyFiles = reader.getLazyFiles();
+    if (GetApplication().isIncrementalSaveEnabled() && isDocumentFile) {
+        std::vector<std::pair<std::string, const Base::Persistence*>> files;
+        for (const auto& [fileName, object] : reader.getFiles()) {
+            if (!reader.hasReadFailed(fileName)) {
+                files.emplace_back(fileName, object);
+            }
+        }
+        d->recordSavedFiles(this, fi.filePath(), files);
+    }
 
     DocumentP::checkStringHasher(reader);
 
@@ -2862,6 +3436,8 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         return 0;
     }
 
+    _flushBulkUpdate();
+
     int objectCount = 0;
     if (testStatus(Document::PartialDoc)) {
         if (mustExecute()) {
@@ -2886,12 +3462,14 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
     d->clearRecomputeLog();
 
     Base::TimeTracker tracker("Document::recompute");
+    RecomputeProfiler::Session profile(d->recomputeProfiler);
     std::optional<Base::ObjectStatusLocker<Document::Status, Document>> recomputingStatus;
     recomputingStatus.emplace(Document::Recomputing, this);
 
     signalBeforeRecompute(*this);
 
     bool fineGrained = GetApplication().isFineGrainedRecomputeEnabled();
+    bool parallel = GetApplication().isParallelRecomputeEnabled();
 
     //////////////////////////////////////////////////////////////////////////
     // FIXME Comment by Realthunder:
@@ -2913,8 +3491,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
    */
 
     // alt:
-    auto topoSortedObjects =
-        getDependencyList(objs.empty() ? d->objectArray : objs, DepSort | options);
+    auto topoSortedObjects = d->getDependencyOrder(objs.empty() ? d->objectArray : objs, options);
 
     for (auto obj : topoSortedObjects) {
         obj->setStatus(ObjectStatus::PendingRecompute, true);
@@ -2926,6 +3503,29 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
 
     tracker.checkpoint("pre-recompute & topo sort");
 
+    // Called after an object has been processed to notify observers and to
+    // touch the objects depending on it.
+    auto onObjectRecomputed = [&](DocumentObject* obj) {
+        signalRecomputedObject(*obj);
+        if (fineGrained) {
+            // set all dependent objects touched based on properties
+            std::vector<DepEdge> inList = obj->getInListProp();
+            for (auto& [objFrom, propFrom, objTo, propTo] : inList) {
+                if (obj->touchedProps.contains(propTo) || propTo.empty()) {
+                    objFrom->enforceRecompute(propFrom);
+                }
+            }
+            obj->purgeTouched();
+        }
+        else {
+            obj->purgeTouched();
+            // set all dependent objects touched to force recompute
+            for (auto inObjIt : obj->getInList()) {
+                inObjIt->enforceRecompute();
+            }
+        }
+    };
+
     try {
         std::set<DocumentObject*> filter;
         size_t idx = 0;
@@ -2937,6 +3537,71 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                                                                 topoSortedObjects.size());
             }
             FC_LOG("Recompute pass " << passes);
+            if (parallel) {
+                std::vector<DocumentObject*> remaining(topoSortedObjects.begin() + idx,
+                                                       topoSortedObjects.end());
+                idx = topoSortedObjects.size();
+                for (auto& wave : groupIntoWaves(remaining)) {
+                    std::vector<DocumentObject*> concurrentObjs;
+                    std::vector<DocumentObject*> serialObjs;
+                    for (auto obj : wave) {
+                        if (!obj->isAttachedToDocument() || filter.contains(obj)
+                            || !obj->mustRecompute()) {
+                            continue;
+                        }
+                        ++objectCount;
+                        if (obj->canRecomputeOnWorker() && obj->canRecomputeConcurrently()) {
+                            concurrentObjs.push_back(obj);
+                        }
+                        else {
+                            serialObjs.push_back(obj);
+                        }
+                    }
+
+                    std::map<DocumentObject*, int> results;
+                    auto concurrentResults =
+                        _recomputeFeaturesConcurrently(concurrentObjs, canAbort);
+                    for (size_t i = 0; i < concurrentObjs.size(); ++i) {
+                        results[concurrentObjs[i]] = concurrentResults[i];
+                    }
+                    for (auto obj : serialObjs) {
+                        results[obj] = _recomputeFeature(obj);
+                    }
+
+                    // Post-process in the sorted order so that signals are
+                    // emitted the same way as by the serial recompute.
+                    bool aborted = false;
+                    for (auto obj : wave) {
+                        if (!obj->isAttachedToDocument() || filter.contains(obj)) {
+                            continue;
+                        }
+                        auto it = results.find(obj);
+                        bool doRecompute = it != results.end();
+                        if (doRecompute && it->second != 0) {
+                            if (hasError) {
+                                *hasError = true;
+                            }
+                            if (it->second < 0) {
+                                aborted = true;
+                                continue;
+                            }
+                            obj->getInListEx(filter, true);
+                            filter.insert(obj);
+                            continue;
+                        }
+                        if (obj->isTouched() || doRecompute) {
+                            onObjectRecomputed(obj);
+                        }
+                        if (seq) {
+                            seq->next(true);
+                        }
+                    }
+                    if (aborted) {
+                        passes = 2;
+                        break;
+                    }
+                }
+            }
             for (; idx < topoSortedObjects.size(); ++idx) {
                 auto obj = topoSortedObjects[idx];
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
@@ -2964,24 +3629,7 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                     }
                 }
                 if (obj->isTouched() || doRecompute) {
-                    signalRecomputedObject(*obj);
-                    if (fineGrained) {
-                        // set all dependent objects touched based on properties
-                        std::vector<DepEdge> inList = obj->getInListProp();
-                        for (auto& [objFrom, propFrom, objTo, propTo] : inList) {
-                            if (obj->touchedProps.contains(propTo) || propTo.empty()) {
-                                objFrom->enforceRecompute(propFrom);
-                            }
-                        }
-                        obj->purgeTouched();
-                    }
-                    else {
-                        obj->purgeTouched();
-                        // set all dependent objects touched to force recompute
-                        for (auto inObjIt : obj->getInList()) {
-                            inObjIt->enforceRecompute();
-                        }
-                    }
+                    onObjectRecomputed(obj);
                 }
                 if (seq) {
                     seq->next(true);
@@ -3238,6 +3886,46 @@ DocumentP::topologicalSort(const std::vector<DocumentObject*>& objects) const
     return ret;
 }
 
+std::vector<DocumentObject*>
+DocumentP::getDependencyOrder(const std::vector<DocumentObject*>& objects, int options)
+{
+    options |= Document::DepSort;
+    bool fineGrained = GetApplication().isFineGrainedRecomputeEnabled();
+    auto isCurrent = [](const auto& epochs) {
+        return std::ranges::all_of(epochs, [](const auto& entry) {
+            return DocumentObject::getDependencyEpoch(entry.first) == entry.second;
+        });
+    };
+    auto& order = dependencyOrder;
+    if (!order.epochs.empty() && order.options == options && order.fineGrained == fineGrained
+        && order.objects == objects && isCurrent(order.epochs)) {
+        return order.sorted;
+    }
+
+    // Sorting also follows links into other documents, so the order depends
+    // on the epochs of all documents involved
+    std::vector<std::pair<const Document*, unsigned long>> epochs;
+    auto addDocument = [&](const DocumentObject* obj) {
+        auto doc = obj->getDocument();
+        if (std::ranges::find(epochs, doc, &decltype(epochs)::value_type::first)
+            == epochs.end()) {
+            epochs.emplace_back(doc, DocumentObject::getDependencyEpoch(doc));
+        }
+    };
+    for (auto obj : objects) {
+        addDocument(obj);
+    }
+    auto sorted = Document::getDependencyList(objects, options);
+    for (auto obj : sorted) {
+        addDocument(obj);
+    }
+    // Do not keep an order computed while the dependencies changed
+    if (isCurrent(epochs)) {
+        order = {std::move(epochs), options, fineGrained, objects, sorted};
+    }
+    return sorted;
+}
+
 std::vector<DocumentObject*> Document::topologicalSort() const
 {
     return d->topologicalSort(d->objectArray);
@@ -3252,15 +3940,27 @@ const char* Document::getErrorDescription(const DocumentObject* Obj) const
 int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
 {
     FC_LOG("Recomputing " << Feat->getFullName());
+    RecomputeProfiler::Scope profile(d->recomputeProfiler, Feat);
+
+    // Expressions read the properties of other objects and may run Python
+    // code, so they are evaluated one at a time in a concurrent recompute.
+    auto executeExpressions = [this, Feat](PropertyExpressionEngine::ExecuteOption option) {
+        auto lock = d->lockConcurrentRecompute();
+        return Feat->ExpressionEngine.execute(option);
+    };
 
     DocumentObjectExecReturn* returnCode = nullptr;
     try {
-        returnCode = Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteNonOutput);
+        returnCode = executeExpressions(PropertyExpressionEngine::ExecuteNonOutput);
         if (returnCode == DocumentObject::StdReturn) {
-            returnCode = Feat->recompute();
+            if (GetApplication().isRecomputeCacheEnabled()) {
+                returnCode = _recomputeCached(Feat);
+            }
+            else {
+                returnCode = Feat->recompute();
+            }
             if (returnCode == DocumentObject::StdReturn) {
-                returnCode =
-                    Feat->ExpressionEngine.execute(PropertyExpressionEngine::ExecuteOutput);
+                returnCode = executeExpressions(PropertyExpressionEngine::ExecuteOutput);
             }
         }
     }
@@ -3306,6 +4006,87 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
     return 0;
 }
 
+DocumentObjectExecReturn* Document::_recomputeCached(DocumentObject* Feat)
+{
+    auto& cache = d->recomputeCache;
+    if (!Feat->canCacheRecompute()) {
+        return Feat->recompute();
+    }
+    if (cache.restore(Feat)) {
+        return DocumentObject::StdReturn;
+    }
+
+    // Record the properties changed by the execution as its output
+    std::set<std::string> changed;
+    fastsignals::scoped_connection conn = Feat->signalChanged.connect(
+        [&changed](const DocumentObject&, const Property& prop) {
+            if (const char* name = prop.getName()) {
+                changed.insert(name);
+            }
+        });
+    DocumentObjectExecReturn* returnCode = Feat->recompute();
+    conn.disconnect();
+
+    if (returnCode == DocumentObject::StdReturn) {
+        cache.store(Feat, changed);
+    }
+    return returnCode;
+}
+
+std::unique_lock<std::recursive_mutex> Document::_lockConcurrentRecompute() const
+{
+    return d->lockConcurrentRecompute();
+}
+
+std::vector<int> Document::_recomputeFeaturesConcurrently(const std::vector<DocumentObject*>& features,
+                                                         bool canAbort)
+{
+    std::vector<int> results(features.size(), 0);
+    if (features.size() == 1) {
+        results[0] = _recomputeFeature(features[0]);
+        return results;
+    }
+    if (features.empty()) {
+        return results;
+    }
+
+    FC_LOG("Recomputing " << features.size() << " objects concurrently");
+    {
+        Base::StateLocker guard(d->concurrentRecompute, true);
+        // Release the GIL so that features evaluating Python expressions on the
+        // worker threads do not dead-lock.
+        Base::PyGILStateRelease release;
+        std::atomic<bool> aborted {false};
+        runConcurrently(features.size(),
+                        GetApplication().getRecomputeThreadCount(),
+                        [this, &features, &results, &aborted, canAbort](std::size_t i) {
+                            auto feature = features[i];
+                            // Do not start any more objects once the user aborted
+                            if (aborted || (canAbort && Base::Sequencer().wasCanceled())) {
+                                aborted = true;
+                                d->addRecomputeLog("User abort", feature);
+                                results[i] = -1;
+                                return;
+                            }
+                            // An exception must not escape the worker thread
+                            try {
+                                results[i] = _recomputeFeature(feature);
+                            }
+                            catch (...) {
+                                FC_ERR("Unknown exception in " << feature->getFullName()
+                                                               << " thrown");
+                                d->addRecomputeLog("Unknown exception!", feature);
+                                results[i] = 1;
+                            }
+                            if (results[i] < 0) {
+                                aborted = true;
+                            }
+                        });
+    }
+    _flushConcurrentChanges();
+    return results;
+}
+
 bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
 {
     // delete recompute log
@@ -3321,6 +4102,7 @@ bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
         recompute({feature}, true, &hasError);
         return !hasError;
     }
+    RecomputeProfiler::Session profile(d->recomputeProfiler);
     _recomputeFeature(feature);
     signalRecomputedObject(*feature);
     return feature->isValid();
@@ -3473,16 +4255,27 @@ void Document::_addObject(DocumentObject* pcObject, const char* pObjectName, Add
     }
     pcObject->_pcViewProviderName = viewType ? viewType : "";
 
-    signalNewObject(*pcObject);
-
     // do no transactions if we do a rollback!
-    if (!d->rollback && d->activeUndoTransaction) {
-        signalTransactionAppend(*pcObject, d->activeUndoTransaction);
+    auto transaction = d->rollback ? nullptr : d->activeUndoTransaction;
+    if (isBulkUpdating()) {
+        d->bulkUpdate.newObjects.push_back({pcObject, transaction});
+        d->bulkUpdate.newObjectSet.insert(pcObject);
+    }
+    else {
+        signalNewObject(*pcObject);
+        if (transaction) {
+            signalTransactionAppend(*pcObject, transaction);
+        }
     }
 
     if (options.testFlag(AddObjectOption::ActivateObject)) {
         d->activeObject = pcObject;
-        signalActivatedObject(*pcObject);
+        if (isBulkUpdating()) {
+            d->bulkUpdate.activatedObject = pcObject;
+        }
+        else {
+            signalActivatedObject(*pcObject);
+        }
     }
 }
 
@@ -3533,6 +4326,9 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
         return;
     }
 
+    // Observers must know the object before it is removed
+    _flushBulkUpdate();
+
     TransactionLocker tlock(this);
 
     _checkTransaction(pcObject, nullptr, __LINE__);
@@ -3575,9 +4371,18 @@ void Document::_removeObject(DocumentObject* pcObject, RemoveObjectOptions optio
     if (!d->undoing && !d->rollback) {
         pcObject->unsetupObject();
     }
+    // Drop the changes deferred while removing, the object may be destroyed
+    std::erase_if(d->bulkUpdate.changes, [&](const auto& change) {
+        if (change.container != pcObject) {
+            return false;
+        }
+        d->bulkUpdate.changeSet.erase(change.prop);
+        return true;
+    });
     signalDeletedObject(*pcObject);
     signalTransactionRemove(*pcObject, d->rollback ? nullptr : d->activeUndoTransaction);
     breakDependency(pcObject, true);
+    d->recomputeCache.remove(pcObject);
 
     // TODO Check me if it's needed (2015-09-01, Fat-Zer)
     // remove the tip if needed
@@ -3631,28 +4436,329 @@ void Document::breakDependency(DocumentObject* pcObject, const bool clear) // NO
     PropertyLinkBase::breakLinks(pcObject, d->objectArray, clear);
 }
 
+// Whether the links of a property are mapped by copyLinks()
+static bool isCopyableLink(const Property* prop)
+{
+    return prop->isDerivedFrom<PropertyLink>() || prop->isDerivedFrom<PropertyLinkList>()
+        || prop->isDerivedFrom<PropertyLinkSub>() || prop->isDerivedFrom<PropertyLinkSubList>();
+}
+
+// Check whether an object can be copied to 'doc' without an XML round-trip
+static bool canCopyInMemory(DocumentObject* obj,
+                            const std::unordered_set<const DocumentObject*>& sources,
+                            const Document* doc)
+{
+    if (!obj->isAttachedToDocument()) {
+        return false;
+    }
+    // Expressions refer to objects by name and are mapped when parsed
+    if (!obj->canCopyInMemory() || obj->ExpressionEngine.numExpressions() > 0) {
+        return false;
+    }
+    std::vector<Property*> props;
+    obj->getPropertyList(props);
+    std::vector<DocumentObject*> links;
+    std::vector<std::string> subs;
+    for (auto prop : props) {
+        // Copy() shares the Python object
+        if (prop->isDerivedFrom<PropertyPythonObject>()) {
+            return false;
+        }
+        auto link = freecad_cast<PropertyLinkBase*>(prop);
+        if (!link || prop == &obj->ExpressionEngine) {
+            continue;
+        }
+        auto xlink = freecad_cast<PropertyXLink*>(prop);
+        if (xlink && !Base::Tools::isNullOrEmpty(xlink->getFilePath())) {
+            return false;
+        }
+        links.clear();
+        subs.clear();
+        link->getLinks(links, true, &subs, false);
+        if (links.empty()) {
+            continue;
+        }
+        if (!isCopyableLink(prop)) {
+            return false;
+        }
+        for (auto linked : links) {
+            if (linked && !sources.contains(linked) && linked->getDocument() != doc) {
+                return false;
+            }
+        }
+        // A subname path refers to objects by name
+        for (const auto& sub : subs) {
+            if (sub.find('.') != std::string::npos) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Set the links of a copied property, replacing the copied objects by their copies
+static void copyLinks(Property* from,
+                      Property* to,
+                      const std::unordered_map<const DocumentObject*, DocumentObject*>& copies,
+                      bool sameDocument)
+{
+    auto mapped = [&copies](DocumentObject* obj) {
+        auto it = copies.find(obj);
+        return it != copies.end() ? it->second : obj;
+    };
+    auto mappedList = [&mapped](const std::vector<DocumentObject*>& objs) {
+        std::vector<DocumentObject*> values;
+        values.reserve(objs.size());
+        for (auto obj : objs) {
+            values.push_back(mapped(obj));
+        }
+        return values;
+    };
+    using ShadowSubs = std::vector<PropertyLinkBase::ShadowSub>;
+    // The mapped element names of another document refer to its string
+    // hasher, they are generated again from the old names after the copy
+    auto shadowSubs = [sameDocument](const ShadowSubs& shadows) {
+        ShadowSubs values(shadows);
+        if (!sameDocument) {
+            for (auto& shadow : values) {
+                shadow.newName.clear();
+            }
+        }
+        return values;
+    };
+
+    if (auto xlink = freecad_cast<PropertyXLink*>(from)) {
+        static_cast<PropertyXLink*>(to)->setValue(mapped(xlink->getValue()),
+                                                  xlink->getSubValues(),
+                                                  shadowSubs(xlink->getShadowSubs()));
+    }
+    else if (auto link = freecad_cast<PropertyLink*>(from)) {
+        static_cast<PropertyLink*>(to)->setValue(mapped(link->getValue()));
+    }
+    else if (auto linkList = freecad_cast<PropertyLinkList*>(from)) {
+        static_cast<PropertyLinkList*>(to)->setValues(mappedList(linkList->getValues()));
+    }
+    else if (auto linkSub = freecad_cast<PropertyLinkSub*>(from)) {
+        static_cast<PropertyLinkSub*>(to)->setValue(mapped(linkSub->getValue()),
+                                                    linkSub->getSubValues(),
+                                                    shadowSubs(linkSub->getShadowSubs()));
+    }
+    else if (auto linkSubList = freecad_cast<PropertyLinkSubList*>(from)) {
+        static_cast<PropertyLinkSubList*>(to)->setValues(
+            mappedList(linkSubList->getValues()),
+            std::vector<std::string>(linkSubList->getSubValues()),
+            shadowSubs(linkSubList->getShadowSubs()));
+    }
+}
+
 std::vector<DocumentObject*>
-Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, bool returnAll)
+Document::_copyObjectsInMemory(const std::vector<DocumentObject*>& objs, bool verbose)
 {
-    std::vector<DocumentObject*> deps;
-    if (!recursive) {
-        deps = objs;
+    std::unordered_set<const DocumentObject*> sources(objs.begin(), objs.end());
+
+    // The import only maps the links between the imported objects, so the
+    // objects linked by an object copied by XML are copied by XML, too
+    std::unordered_set<const DocumentObject*> byXml;
+    std::vector<DocumentObject*> pending;
+    for (auto obj : objs) {
+        if (!canCopyInMemory(obj, sources, this)) {
+            byXml.insert(obj);
+            pending.push_back(obj);
+        }
     }
-    else {
-        deps = getDependencyList(objs, DepNoXLinked | DepSort);
+    while (!pending.empty()) {
+        auto obj = pending.back();
+        pending.pop_back();
+        for (auto linked : obj->getOutList()) {
+            if (sources.contains(linked) && byXml.insert(linked).second) {
+                pending.push_back(linked);
+            }
+        }
     }
 
-    if (!testStatus(TempDoc) && !isSaved() && PropertyXLink::hasXLink(deps)) {
-        throw Base::RuntimeError(
-            "Document must be saved at least once before link to external objects");
+    std::unordered_map<const DocumentObject*, DocumentObject*> copies;
+    std::vector<DocumentObject*> imported;
+    if (!byXml.empty()) {
+        std::vector<DocumentObject*> xmlObjs;
+        xmlObjs.reserve(byXml.size());
+        for (auto obj : objs) {
+            if (byXml.contains(obj)) {
+                xmlObjs.push_back(obj);
+            }
+        }
+        imported = _copyObjectsByXml(xmlObjs, verbose);
+        if (xmlObjs.size() == objs.size()) {
+            return imported;
+        }
+        if (imported.size() == xmlObjs.size()) {
+            for (std::size_t i = 0; i < xmlObjs.size(); ++i) {
+                copies[xmlObjs[i]] = imported[i];
+            }
+        }
+    }
+
+    // Same state as importObjects(), so that the objects treat the copy as an import
+    d->hashers.clear();
+    Base::FlagToggler<> flag(globalIsRestoring, false);
+    Base::ObjectStatusLocker<Status, Document> restoreBit(Status::Restoring, this);
+    Base::ObjectStatusLocker<Status, Document> restoreBit2(Status::Importing, this);
+    d->touchedObjs.clear();
+    bool keepDigits = testStatus(Document::KeepTrailingDigits);
+    setStatus(Document::KeepTrailingDigits, false);
+
+    // Create all objects first to map the links between them
+    std::vector<std::pair<DocumentObject*, DocumentObject*>> copied;
+    copied.reserve(objs.size() - byXml.size());
+    for (auto obj : objs) {
+        if (byXml.contains(obj)) {
+            continue;
+        }
+        std::string viewType = obj->getViewProviderNameStored();
+        if (viewType == obj->getViewProviderName()) {
+            viewType.clear();
+        }
+        try {
+            auto copy = addObject(obj->getTypeId().getName(),
+                                  obj->getNameInDocument(),
+                                  /*isNew=*/false,
+                                  viewType.c_str());
+            if (!copy) {
+                continue;
+            }
+            copies[obj] = copy;
+            copied.emplace_back(obj, copy);
+            if (obj->testStatus(ObjectStatus::Touch)) {
+                d->touchedObjs.insert(copy);
+            }
+            copy->setStatus(ObjectStatus::Error, obj->isError());
+            if (obj->isFreezed()) {
+                copy->freeze();
+            }
+        }
+        catch (const Base::Exception& e) {
+            Base::Console().error("Cannot create object '%s': (%s)\n",
+                                  obj->getNameInDocument(),
+                                  e.what());
+        }
+    }
+    setStatus(Document::KeepTrailingDigits, keepDigits);
+
+    std::vector<Property*> props;
+    for (auto [obj, copy] : copied) {
+        copy->setStatus(ObjectStatus::Restore, true);
+        // Properties are restored in the order of their names
+        std::map<std::string, Property*> propMap;
+        obj->getPropertyMap(propMap);
+        for (const auto& [name, prop] : propMap) {
+            if (prop->testStatus(Property::PropNoPersist)) {
+                continue;
+            }
+            try {
+                auto target = copy->getPropertyByName(name.c_str());
+                if (!target || target->getContainer() != copy) {
+                    if (!prop->testStatus(Property::PropDynamic)) {
+                        continue;
+                    }
+                    auto data = obj->getDynamicPropertyData(prop);
+                    target = copy->addDynamicProperty(prop->getTypeId().getName(),
+                                                      name.c_str(),
+                                                      data.group.c_str(),
+                                                      data.doc.c_str(),
+                                                      data.attr,
+                                                      data.readonly,
+                                                      data.hidden);
+                }
+                target->setStatusValue(prop->getStatus());
+                if (target->getTypeId() != prop->getTypeId()
+                    || prop->testStatus(Property::Transient)
+                    || prop->testStatus(Property::PropTransient)
+                    || (prop->getType() & Prop_Transient) != 0) {
+                    continue;
+                }
+                if (isCopyableLink(prop)) {
+                    copyLinks(prop, target, copies, obj->getDocument() == this);
+                }
+                else {
+                    std::unique_ptr<Property> value(prop->Copy());
+                    target->Paste(*value);
+                }
+            }
+            catch (const Base::Exception& e) {
+                Base::Console().error("%s\n", e.what());
+            }
+            catch (const std::exception& e) {
+                Base::Console().error("%s\n", e.what());
+            }
+        }
+        copy->setStatus(ObjectStatus::Restore, false);
+        copy->setStatus(ObjImporting, true);
+        FC_LOG("copying " << obj->getFullName() << " to " << copy->getFullName());
+        renewObjectUuid(copy);
+    }
+
+    std::vector<DocumentObject*> sourceObjs;
+    std::vector<DocumentObject*> result;
+    sourceObjs.reserve(copied.size());
+    result.reserve(copied.size());
+    for (auto [obj, copy] : copied) {
+        sourceObjs.push_back(obj);
+        result.push_back(copy);
     }
 
+    // Now that all shapes are copied, map the element references of objects
+    // copied from other documents
+    for (auto [obj, copy] : copied) {
+        if (obj->getDocument() == this) {
+            continue;
+        }
+        props.clear();
+        copy->getPropertyList(props);
+        for (auto prop : props) {
+            if (isCopyableLink(prop)) {
+                static_cast<PropertyLinkBase*>(prop)->updateElementReference(nullptr);
+            }
+        }
+    }
+
+    signalCopyViewObjects(sourceObjs, result);
+    afterRestore(result, true);
+    signalFinishImportObjects(result);
+
+    for (const auto copy : result) {
+        if (copy->isAttachedToDocument()) {
+            copy->setStatus(ObjImporting, false);
+        }
+    }
+
+    d->hashers.clear();
+
+    // Return the copies in the order of their objects, unless the import failed
+    if (imported.size() != byXml.size()) {
+        imported.insert(imported.end(), result.begin(), result.end());
+        return imported;
+    }
+    for (auto [obj, copy] : copied) {
+        copies[obj] = copy;
+    }
+    result.clear();
+    for (auto obj : objs) {
+        auto it = copies.find(obj);
+        if (it != copies.end()) {
+            result.push_back(it->second);
+        }
+    }
+    return result;
+}
+
+std::vector<DocumentObject*>
+Document::_copyObjectsByXml(const std::vector<DocumentObject*>& objs, bool verbose)
+{
     MergeDocuments md(this);
     // if not copying recursively then suppress possible warnings
-    md.setVerbose(recursive);
+    md.setVerbose(verbose);
 
     unsigned int memsize = 1000;  // ~ for the meta-information
-    for (auto it : deps) {
+    for (auto it : objs) {
         memsize += it->getMemSize();
     }
 
@@ -3666,25 +4772,51 @@ Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, b
         use_buffer = false;
     }
 
-    std::vector<DocumentObject*> imported;
     if (use_buffer) {
         Base::StringOStreambuf obuf(res);
         std::ostream ostr(&obuf);
-        exportObjects(deps, ostr);
+        exportObjects(objs, ostr);
 
         Base::StringIStreambuf ibuf(res);
         std::istream istr(nullptr);
         istr.rdbuf(&ibuf);
-        imported = md.importObjects(istr);
+        return md.importObjects(istr);
+    }
+
+    static Base::FileInfo fi(Application::getTempFileName());
+    Base::ofstream ostr(fi, std::ios::out | std::ios::binary);
+    exportObjects(objs, ostr);
+    ostr.close();
+
+    Base::ifstream istr(fi, std::ios::in | std::ios::binary);
+    return md.importObjects(istr);
+}
+
+std::vector<DocumentObject*>
+Document::copyObject(const std::vector<DocumentObject*>& objs, bool recursive, bool returnAll)
+{
+    std::vector<DocumentObject*> deps;
+    if (!recursive) {
+        deps = objs;
     }
     else {
-        static Base::FileInfo fi(Application::getTempFileName());
-        Base::ofstream ostr(fi, std::ios::out | std::ios::binary);
-        exportObjects(deps, ostr);
-        ostr.close();
+        deps = getDependencyList(objs, DepNoXLinked | DepSort);
+    }
 
-        Base::ifstream istr(fi, std::ios::in | std::ios::binary);
-        imported = md.importObjects(istr);
+    if (!testStatus(TempDoc) && !isSaved() && PropertyXLink::hasXLink(deps)) {
+        throw Base::RuntimeError(
+            "Document must be saved at least once before link to external objects");
+    }
+
+    std::vector<DocumentObject*> imported;
+
+    auto hGrp = GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document");
+    if (!deps.empty() && hGrp->GetBool("CopyInMemory", true)) {
+        imported = _copyObjectsInMemory(deps, recursive);
+    }
+    else {
+        imported = _copyObjectsByXml(deps, recursive);
     }
 
     if (returnAll || imported.size() != deps.size()) {
@@ -43,6 +43,7 @@
 #include <vector>
 #include <utility>
 #include <list>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -88,8 +89,38 @@ class DocumentPy;
 class Application;
 class Transaction;
 class StringHasher;
+class RecomputeCache;
+class RecomputeProfiler;
 using StringHasherRef = Base::Reference<StringHasher>;
 
+/**
+ * @brief The memory used by a document broken down by consumer.
+ *
+ * All sizes are in bytes, see Document::getMemoryUsage().
+ */
+struct AppExport DocumentMemoryUsage
+{
+    /// The memory of each object including its properties, by object name.
+    std::map<std::string, std::size_t> objects;
+    /// The memory of the properties of all objects, by property type name.
+    std::map<std::string, std::size_t> propertyTypes;
+    /// The memory of the properties of the document itself.
+    std::size_t documentProperties {0};
+    /// The memory of the undo transactions, including an open one.
+    std::size_t undo {0};
+    /// The memory of the redo transactions.
+    std::size_t redo {0};
+    /// The memory of the string hasher used by the topological naming.
+    std::size_t stringHasher {0};
+    /// The memory of the element maps, already included in the objects.
+    std::size_t elementMaps {0};
+    /// The memory of the recompute cache.
+    std::size_t recomputeCache {0};
+
+    /// The total memory of the document.
+    std::size_t total() const;
+};
+
 /**
  * @brief A class that represents a FreeCAD document.
  *
@@ -251,6 +282,9 @@ public:
                                  const std::map<std::string, std::string>&)> signalImportViewObjects;
     /// Signal after finishing importing objects.
     App::MainThreadSignal<void(const std::vector<DocumentObject*>&)> signalFinishImportObjects;
+    /// Signal on copying view objects of the first list to the objects of the second one.
+    App::MainThreadSignal<void(const std::vector<DocumentObject*>&,
+                                 const std::vector<DocumentObject*>&)> signalCopyViewObjects;
     /// Signal starting a save action to a file.
     App::MainThreadSignal<void(const Document&, const std::string&)> signalStartSave;
     /// Signal finishing a save action to a file.
@@ -461,6 +495,19 @@ public:
 
     unsigned int getMemSize() const override;
 
+    /**
+     * @brief Get the memory used by the document.
+     *
+     * Unlike getMemSize() the memory is broken down by object, property type,
+     * undo history and topological naming data. List values shared between
+     * objects or with undo snapshots are divided among their owners, so they
+     * are counted once. Postponed geometry data is not read, its size in the
+     * file is counted instead and its element map is left out.
+     *
+     * @return The memory usage of the document.
+     */
+    DocumentMemoryUsage getMemoryUsage() const;
+
     /** @name Object handling
      * @{
      */
@@ -944,16 +991,76 @@ public:
 
     /**
      * @brief Set the undo limit.
-     * @param[in] UndoMemSize The maximum memory in bytes.
+     *
+     * If the undo and redo stacks use more memory than the limit the oldest
+     * transactions are dropped. The last transaction is always kept.
+     *
+     * @param[in] UndoMemSize The maximum memory in bytes, 0 means no limit.
      */
     void setUndoLimit(unsigned int UndoMemSize = 0);
 
+    /**
+     * @brief Get the undo limit.
+     * @return The maximum memory of the undo stack in bytes, 0 means no limit.
+     */
+    unsigned int getUndoLimit() const;
+
     /**
      * @brief Get the undo memory size.
-     * @return The memory used by the undo stack in bytes.
+     * @return The memory used by the undo and redo stacks in bytes.
      */
     unsigned int getUndoMemSize() const;
 
+    /**
+     * @brief Get the cache of recompute results.
+     *
+     * @return The recompute cache of this document.
+     * @see DocumentObject::canCacheRecompute()
+     */
+    RecomputeCache& getRecomputeCache() const;
+
+    /**
+     * @brief Get the profiler of recomputes.
+     *
+     * @return The execution times of the objects of the last recomputes.
+     */
+    RecomputeProfiler& getRecomputeProfiler() const;
+
+    /**
+     * @brief Get the generation of the names in the document.
+     *
+     * The generation advances whenever objects or dynamic properties are
+     * added, removed or renamed, or an object is relabeled. Property
+     * references resolved by name stay valid while it does not change.
+     *
+     * @return The current name generation, never 0.
+     * @see CompiledExpression
+     */
+    unsigned long getNameGeneration() const;
+
+    /// Start a new generation of names, see getNameGeneration().
+    void advanceNameGeneration();
+
+    /**
+     * @brief Begin a bulk update of the document.
+     *
+     * Until the matching endBulkUpdate() the signals about new objects and
+     * changed properties are deferred, and a property changed several times
+     * is only signaled once. An object created during the bulk update is only
+     * signaled by signalNewObject() in its final state. The signal before a
+     * change is only emitted for the first change of a property.
+     *
+     * The deferred signals are emitted before an object is removed, the
+     * document is recomputed or saved. Bulk updates can be nested.
+     */
+    void beginBulkUpdate();
+
+    /// End a bulk update and emit the deferred signals, see beginBulkUpdate().
+    void endBulkUpdate();
+
+    /// Check whether a bulk update is active.
+    bool isBulkUpdating() const;
+
     /**
      * @brief Set the Undo limit as stack size.
      *
@@ -1422,9 +1529,97 @@ protected:
      */
     int _recomputeFeature(DocumentObject* Feat);
 
+    /**
+     * @brief Recompute independent objects concurrently.
+     *
+     * The objects are executed on a pool of threads with the Python global
+     * interpreter lock released. They must not depend on each other and must
+     * allow concurrent recomputation, see
+     * DocumentObject::canRecomputeConcurrently().
+     *
+     * @param[in] features The objects to recompute.
+     * @param[in] canAbort Whether to stop starting objects once the user
+     * cancelled the recompute.
+     * @return The result of _recomputeFeature() for each object, -1 for the
+     * objects that were skipped because of an abort.
+     */
+    std::vector<int> _recomputeFeaturesConcurrently(const std::vector<DocumentObject*>& features,
+                                                    bool canAbort);
+
+    /// Lock the document bookkeeping if objects are recomputed concurrently.
+    std::unique_lock<std::recursive_mutex> _lockConcurrentRecompute() const;
+
+    /**
+     * @brief Recompute an object using the recompute cache.
+     *
+     * @param[in] Feat The object to recompute.
+     * @return The result of DocumentObject::recompute().
+     */
+    DocumentObjectExecReturn* _recomputeCached(DocumentObject* Feat);
+
     /// Clear the redos.
     void _clearRedos();
 
+    /**
+     * @brief Copy objects with Property::Copy() and Property::Paste().
+     *
+     * The links between the copied objects are mapped to the copies. Links to
+     * other objects are kept, so these must be in this document. The view
+     * objects are copied by signalCopyViewObjects. Objects that cannot be
+     * copied this way and the objects they link to are copied by
+     * _copyObjectsByXml() instead.
+     *
+     * @param[in] objs The objects to copy, sorted by their dependencies.
+     * @param[in] verbose Whether to report import warnings.
+     *
+     * @return The copied objects.
+     */
+    std::vector<DocumentObject*> _copyObjectsInMemory(const std::vector<DocumentObject*>& objs,
+                                                      bool verbose);
+
+    /**
+     * @brief Copy objects by exporting and importing them as XML.
+     *
+     * @param[in] objs The objects to copy, sorted by their dependencies.
+     * @param[in] verbose Whether to report import warnings.
+     *
+     * @return The copied objects.
+     */
+    std::vector<DocumentObject*> _copyObjectsByXml(const std::vector<DocumentObject*>& objs,
+                                                   bool verbose);
+
+    /**
+     * @brief Check whether the signal of a property change is deferred.
+     *
+     * @param[in] container The document or object owning the property.
+     * @param[in] prop The changed property.
+     * @param[in] before Whether the signal is the one before the change.
+     *
+     * @return True if the signal must not be emitted now.
+     */
+    bool _deferChangeSignal(const PropertyContainer* container, const Property* prop, bool before);
+
+    /// Emit the signals deferred by a bulk update.
+    void _flushBulkUpdate();
+
+    /**
+     * @brief Check whether the signal of an object change is deferred until
+     * the end of a concurrent recompute.
+     *
+     * @param[in] obj The object owning the property.
+     * @param[in] prop The changed property.
+     * @param[in] before Whether the signal is the one before the change.
+     *
+     * @return True if the signal must not be emitted now.
+     */
+    bool _deferConcurrentChange(const DocumentObject* obj, const Property* prop, bool before);
+
+    /// Emit the signals deferred by a concurrent recompute on the calling thread.
+    void _flushConcurrentChanges();
+
+    /// Drop the oldest undo transactions exceeding the stack size or memory limit.
+    void _checkUndoLimits();
+
     /**
      * @brief Get the name of the transient directory for a given UUID and filename.
      *
@@ -1487,6 +1682,28 @@ private:
     bool autoCreated;    // Flag to know if the document was automatically created at startup
 };
 
+/**
+ * @brief A helper class for bulk updates of a document.
+ *
+ * A BulkUpdateGuard object is meant to be allocated on the stack. It begins a
+ * bulk update of the document on construction and ends it on destruction, see
+ * Document::beginBulkUpdate().
+ */
+class AppExport BulkUpdateGuard
+{
+public:
+    explicit BulkUpdateGuard(Document* doc);
+    ~BulkUpdateGuard();
+
+    BulkUpdateGuard(const BulkUpdateGuard&) = delete;
+    BulkUpdateGuard(BulkUpdateGuard&&) = delete;
+    BulkUpdateGuard& operator=(const BulkUpdateGuard&) = delete;
+    BulkUpdateGuard& operator=(BulkUpdateGuard&&) = delete;
+
+private:
+    Document* doc;
+};
+
 template<typename T>
 inline std::vector<T*> Document::getObjectsOfType() const
 {
@@ -2,11 +2,12 @@
 
 from __future__ import annotations
 
+from contextlib import AbstractContextManager
 from Base.Metadata import constmethod
 from PropertyContainer import PropertyContainer
 from DocumentObject import DocumentObject
 from DocumentSettings import DocumentSettings
-from typing import TYPE_CHECKING, Final, Literal, Sequence, overload
+from typing import TYPE_CHECKING, Any, Final, Literal, Sequence, overload
 
 if TYPE_CHECKING:
     from Part import Feature as _PartFeature
@@ -89,6 +90,24 @@ class Document(PropertyContainer):
     Temporary: Final[bool] = False
     """Check if this is a temporary document"""
 
+    RecomputeCacheStats: Final[dict[str, int]] = {}
+    """Statistics of the recompute cache: Hits, Misses, Entries and MemSize"""
+
+    MemoryUsage: Final[dict[str, Any]] = {}
+    """
+    The memory used by the document in bytes. Besides the Total it contains the
+    memory of the Objects and of the PropertyTypes as dictionaries by name, and
+    of the DocumentProperties, Undo, Redo, StringHasher, ElementMaps and
+    RecomputeCache. The ElementMaps are already included in the Objects.
+    """
+
+    RecomputeProfile: Final[list[dict[str, Any]]] = []
+    """
+    The profiles of the last recomputes, the most recent last. Each profile has
+    the Start time in seconds since the epoch, the total wall Time in seconds and
+    the list of executed Objects with their Name, Label, Type, Time and Executions.
+    """
+
     def save(self) -> None:
         """
         Save the document to disk.
@@ -208,6 +227,40 @@ class Document(PropertyContainer):
         """
         ...
 
+    def beginBulkUpdate(self) -> None:
+        """
+        Begin a bulk update of the document
+
+        Until the matching endBulkUpdate() the notifications about new objects and
+        changed properties are deferred, and sent once per object and property.
+        The view provider of an object created meanwhile is only created when the
+        bulk update ends, until then obj.ViewObject is None.
+
+        Prefer bulkUpdate(), which also ends the bulk update if an exception is raised.
+        """
+        ...
+
+    def endBulkUpdate(self) -> None:
+        """
+        End a bulk update and send the deferred notifications
+        """
+        ...
+
+    def bulkUpdate(self) -> AbstractContextManager[None]:
+        """
+        Return a context manager for a bulk update of the document
+
+        The bulk update begins when entering the with statement and always ends
+        when leaving it, see beginBulkUpdate():
+
+            with doc.bulkUpdate():
+                for i in range(100):
+                    doc.addObject("App::FeaturePython")
+
+        Inside the with statement obj.ViewObject is None for the objects created there.
+        """
+        ...
+
     @overload
     def addObject(
         self,
@@ -525,3 +578,15 @@ class Document(PropertyContainer):
         the next transaction will stick to if no change has occurred yet
         """
         ...
+
+    def clearRecomputeCache(self) -> None:
+        """
+        Remove all cached recompute results of the document
+        """
+        ...
+
+    def dumpRecomputeProfile(self) -> str:
+        """
+        Returns the profiles of the last recomputes as JSON
+        """
+        ...
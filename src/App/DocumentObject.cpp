@@ -23,10 +23,13 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <stack>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -55,6 +58,180 @@ FC_LOG_LEVEL_INIT("App", true, true)
 
 using namespace App;
 
+namespace
+{
+
+// The recursive in and out lists of the objects queried since their
+// dependencies last changed. Each document has its own dependency epoch, so a
+// change in one document leaves the lists of the others alone. A list records
+// the epochs of all documents its objects belong to, which keeps lists
+// spanning documents through external links correct. The lists of a long
+// dependency chain grow quadratically with its length, so the cache is dropped
+// once it holds too many entries.
+class RecursiveListCache
+{
+public:
+    using List = std::vector<DocumentObject*>;
+    using ListPtr = std::shared_ptr<const List>;
+
+    static constexpr std::size_t MaxEntries = 1 << 22;
+
+    RecursiveListCache()
+    {
+        // Objects entering or leaving a document change which back links
+        // count, see isAttachedToDocument() in getInListEx().
+        auto& app = GetApplication();
+        app.signalNewObject.connect([this](const DocumentObject& obj) {
+            advance(obj.getDocument());
+        });
+        app.signalDeletedObject.connect([this](const DocumentObject& obj) {
+            advance(obj.getDocument());
+        });
+        app.signalDeleteDocument.connect([this](const Document& doc) {
+            remove(&doc);
+        });
+    }
+
+    // The shared list is never modified, so callers may read it without the lock
+    ListPtr find(const DocumentObject* obj, bool inList)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& lists = inList ? inLists : outLists;
+        auto it = lists.find(obj);
+        if (it == lists.end()) {
+            return {};
+        }
+        for (const auto& [doc, docEpoch] : it->second.epochs) {
+            if (epochLocked(doc) != docEpoch) {
+                entries -= it->second.list->size() + 1;
+                lists.erase(it);
+                return {};
+            }
+        }
+        return it->second.list;
+    }
+
+    // Stores a list computed after the given epoch, unless the dependencies
+    // of any document involved changed meanwhile.
+    void insert(const DocumentObject* obj, bool inList, unsigned long since, const List& list)
+    {
+        Entry entry {std::make_shared<const List>(list), {}};
+        auto addDocument = [&](const DocumentObject* o) {
+            const Document* doc = o->getDocument();
+            if (std::ranges::find(entry.epochs, doc, &DocumentEpoch::first)
+                == entry.epochs.end()) {
+                entry.epochs.emplace_back(doc, 0);
+            }
+        };
+        addDocument(obj);
+        for (auto o : list) {
+            addDocument(o);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& [doc, docEpoch] : entry.epochs) {
+            docEpoch = epochLocked(doc);
+            if (docEpoch > since) {
+                return;
+            }
+        }
+        if (entries + list.size() > MaxEntries) {
+            clear();
+        }
+        auto& lists = inList ? inLists : outLists;
+        auto res = lists.insert_or_assign(obj, std::move(entry));
+        if (res.second) {
+            entries += list.size() + 1;
+        }
+    }
+
+    unsigned long epoch(const Document* doc)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return epochLocked(doc);
+    }
+
+    unsigned long current()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return counter;
+    }
+
+    void advance(const Document* doc)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        documentEpochs[doc] = ++counter;
+    }
+
+private:
+    using DocumentEpoch = std::pair<const Document*, unsigned long>;
+
+    struct Entry
+    {
+        ListPtr list;
+        std::vector<DocumentEpoch> epochs;
+    };
+
+    // Epochs are taken from one counter and never reused, so a document
+    // created at the address of a closed one does not match its old lists.
+    unsigned long epochLocked(const Document* doc)
+    {
+        auto res = documentEpochs.emplace(doc, 0);
+        if (res.second) {
+            res.first->second = ++counter;
+        }
+        return res.first->second;
+    }
+
+    void remove(const Document* doc)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        documentEpochs.erase(doc);
+        // Drop the lists of the closed objects as well
+        clear();
+    }
+
+    void clear()
+    {
+        inLists.clear();
+        outLists.clear();
+        entries = 0;
+    }
+
+    std::mutex mutex;
+    unsigned long counter = 0;
+    std::size_t entries = 0;
+    std::unordered_map<const Document*, unsigned long> documentEpochs;
+    std::unordered_map<const DocumentObject*, Entry> inLists;
+    std::unordered_map<const DocumentObject*, Entry> outLists;
+};
+
+RecursiveListCache& recursiveListCache()
+{
+    static RecursiveListCache cache;
+    return cache;
+}
+
+void advanceDependencyEpoch(const DocumentObject* obj)
+{
+    if (obj) {
+        recursiveListCache().advance(obj->getDocument());
+    }
+}
+
+std::uint64_t nextChangeSerial()
+{
+    static std::atomic<std::uint64_t> serial {0};
+    return ++serial;
+}
+
+}  // namespace
+
+unsigned long DocumentObject::getDependencyEpoch(const Document* doc)
+{
+    return recursiveListCache().epoch(doc);
+}
+
 
 PROPERTY_SOURCE(App::DocumentObject, App::TransactionalObject)
 
@@ -66,6 +243,7 @@ DocumentObjectExecReturn* DocumentObject::StdReturn = nullptr;
 
 DocumentObject::DocumentObject()
     : ExpressionEngine()
+    , _changeSerial(nextChangeSerial())
 {
     // define Label of type 'Output' to avoid being marked as touched after relabeling
     ADD_PROPERTY_TYPE(Label, ("Unnamed"), "Base", Prop_Output, "User name of the object (UTF8)");
@@ -558,9 +736,16 @@ const std::vector<DepEdge>& DocumentObject::getInListProp() const
 
 std::vector<App::DocumentObject*> DocumentObject::getInListRecursive() const
 {
-    std::set<App::DocumentObject*> inSet;
+    auto& cache = recursiveListCache();
+    if (auto list = cache.find(this, true)) {
+        return *list;
+    }
+
+    auto since = cache.current();
     std::vector<App::DocumentObject*> res;
+    std::set<App::DocumentObject*> inSet;
     getInListEx(inSet, true, &res);
+    cache.insert(this, true, since, res);
     return res;
 }
 
@@ -624,6 +809,10 @@ void DocumentObject::getInListExProp(
 
 std::set<App::DocumentObject*> DocumentObject::getInListEx(bool recursive) const
 {
+    if (recursive) {
+        auto inList = getInListRecursive();
+        return {inList.begin(), inList.end()};
+    }
     std::set<App::DocumentObject*> ret;
     getInListEx(ret, recursive);
     return ret;
@@ -661,6 +850,12 @@ void _getOutListRecursive(std::set<DocumentObject*>& objSet,
 
 std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
 {
+    auto& cache = recursiveListCache();
+    if (auto list = cache.find(this, false)) {
+        return *list;
+    }
+
+    auto since = cache.current();
     // number of objects in document is a good estimate in result size
     int maxDepth = GetApplication().checkLinkDepth(0);
     std::set<App::DocumentObject*> result;
@@ -668,8 +863,8 @@ std::vector<App::DocumentObject*> DocumentObject::getOutListRecursive() const
     // using a recursive helper to collect all OutLists
     _getOutListRecursive(result, this, this, maxDepth);
 
-    std::vector<App::DocumentObject*> array;
-    array.insert(array.begin(), result.begin(), result.end());
+    std::vector<App::DocumentObject*> array(result.begin(), result.end());
+    cache.insert(this, false, since, array);
     return array;
 }
 
@@ -696,7 +891,15 @@ bool _isInInListRecursive(const DocumentObject* act, const DocumentObject* check
 
 bool DocumentObject::isInInListRecursive(DocumentObject* linkTo) const
 {
-    return this == linkTo || getInListEx(true).contains(linkTo);
+    if (this == linkTo) {
+        return true;
+    }
+    // Search the cached list in place instead of copying it
+    if (auto list = recursiveListCache().find(this, true)) {
+        return std::ranges::find(*list, linkTo) != list->end();
+    }
+    auto inList = getInListRecursive();
+    return std::ranges::find(inList, linkTo) != inList.end();
 }
 
 bool DocumentObject::isInInList(DocumentObject* linkTo) const
@@ -1036,12 +1239,22 @@ App::Property* DocumentObject::addDynamicProperty(
     return prop;
 }
 
+std::unique_lock<std::recursive_mutex> DocumentObject::lockConcurrentRecompute() const
+{
+    if (_pDoc) {
+        return _pDoc->_lockConcurrentRecompute();
+    }
+    return {};
+}
+
 void DocumentObject::onBeforeChange(const Property* prop)
 {
     if (isFreezed() && prop != &Visibility) {
         return;
     }
 
+    auto lock = lockConcurrentRecompute();
+
     // Store current name in oldLabel, to be able to easily retrieve old name of document object later
     // when renaming expressions.
     if (prop == &Label)
@@ -1126,6 +1339,8 @@ void DocumentObject::onEarlyChange(const Property* prop)
         return;
     }
 
+    auto lock = lockConcurrentRecompute();
+
     if (GetApplication().isClosingAll()) {
         return;
     }
@@ -1146,6 +1361,9 @@ void DocumentObject::onEarlyChange(const Property* prop)
 /// get called by the container when a Property was changed
 void DocumentObject::onChanged(const Property* prop)
 {
+    auto lock = lockConcurrentRecompute();
+    _changeSerial = nextChangeSerial();
+
     if (prop == &Label && _pDoc && _pDoc->containsObject(this) && oldLabel != Label.getStrValue()) {
         _pDoc->unregisterLabel(oldLabel);
         _pDoc->registerLabel(Label.getStrValue());
@@ -1229,6 +1447,8 @@ void DocumentObject::onChanged(const Property* prop)
 
 void DocumentObject::clearOutListCache() const
 {
+    advanceDependencyEpoch(this);
+
     _outList.clear();
     _outListMap.clear();
     _outListCached = false;
@@ -1582,6 +1802,8 @@ void App::DocumentObject::_removeBackLink(DocumentObject* rmvObj)
     auto it = std::ranges::find(_inList, rmvObj);
     if (it != _inList.end()) {
         _inList.erase(it);
+        advanceDependencyEpoch(this);
+        advanceDependencyEpoch(rmvObj);
     }
 }
 
@@ -1592,6 +1814,8 @@ void App::DocumentObject::_addBackLink(DocumentObject* newObj)
     // only once this removal would clear the object from the inlist, even though there may be other
     // link properties from this object that link to us.
     _inList.push_back(newObj);
+    advanceDependencyEpoch(this);
+    advanceDependencyEpoch(newObj);
 }
 
 // Fully mimics _removeBackLink()
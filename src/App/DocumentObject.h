@@ -35,10 +35,13 @@
 #include <Base/SmartPtrPy.h>
 #include <Base/Placement.h>
 
+#include <atomic>
 #include <bitset>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
@@ -577,6 +580,21 @@ public:
     /// Clear the internal OutList cache.
     void clearOutListCache() const;
 
+    /**
+     * @brief Get the dependency epoch of a document.
+     *
+     * The epoch advances whenever a link from or to an object of the document
+     * changes or an object is added to or removed from it. The recursive
+     * InList and OutList are cached until the epoch of any document they
+     * involve changes. All documents draw their epochs from one increasing
+     * counter, so an epoch value is never reused.
+     *
+     * @param[in] doc The document.
+     *
+     * @return The current dependency epoch of the document.
+     */
+    static unsigned long getDependencyEpoch(const Document* doc);
+
     /**
      * @brief Get all possible paths from this object to another object.
      *
@@ -1080,6 +1098,7 @@ public:
     friend class Document;
     friend class Transaction;
     friend class ObjectExecution;
+    friend class RecomputeCache;
 
     /**
      * @brief The standard return object for document object execution.
@@ -1323,6 +1342,68 @@ public:
         return true;
     }
 
+    /**
+     * @brief Whether this object may be recomputed concurrently with other objects.
+     *
+     * This is used by the parallel recompute scheduler of Document::recompute()
+     * to execute objects that do not depend on each other at the same time on
+     * a pool of threads. Only objects that also return true from
+     * canRecomputeOnWorker() are considered.
+     *
+     * Returning true means execute() only modifies the object's own
+     * properties, does not change any link property, and does not need the
+     * Python global interpreter lock. Objects that return false are executed
+     * one after another on the calling thread while holding the lock.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Whether the result of this object's recompute may be cached.
+     *
+     * If true and the recompute cache of the document is enabled, the
+     * properties changed by recompute() are stored keyed by a digest of the
+     * object's input properties and its dependencies. A later recompute with
+     * identical input restores those properties instead of calling execute().
+     *
+     * Returning true means execute() is a pure function of the object's
+     * properties and linked objects, and does not change link properties.
+     * No object of the standard modules opts in yet.
+     *
+     * @see App::RecomputeCache
+     */
+    virtual bool canCacheRecompute() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Get the serial number of the last change of a property.
+     *
+     * The number changes whenever a property of the object changes and is
+     * never shared by two objects, including objects of other documents.
+     *
+     * @see App::RecomputeCache
+     */
+    std::uint64_t getChangeSerial() const
+    {
+        return _changeSerial;
+    }
+
+    /**
+     * @brief Whether this object may be copied without an XML round-trip.
+     *
+     * Document::copyObject() copies the properties of such objects with
+     * Property::Copy() and Property::Paste(). Objects that save anything
+     * besides their properties in Save() must return false.
+     */
+    virtual bool canCopyInMemory() const
+    {
+        return true;
+    }
+
     /**
      * @brief Called when an element reference is updated.
      *
@@ -1459,6 +1540,9 @@ protected:
     void onChanged(const Property* prop) override;
     void onEarlyChange(const Property* prop) override;
 
+    /// Serialize change notifications while the document recomputes objects concurrently.
+    std::unique_lock<std::recursive_mutex> lockConcurrentRecompute() const;
+
     /// Called after a document has been fully restored.
     virtual void onDocumentRestored();
 
@@ -1517,6 +1601,9 @@ private:
 private:
     std::unordered_set<std::string> touchedProps;
 
+    // see getChangeSerial(), restored by App::RecomputeCache with a cached result
+    std::atomic<std::uint64_t> _changeSerial;
+
 private:
     // Back pointer to all the fathers in a DAG of the document
     // this is used by the document (via friend) to have a effective DAG handling
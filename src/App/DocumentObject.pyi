@@ -73,6 +73,9 @@ class DocumentObject(ExtensionContainer):
     OldLabel: Final[str] = ""
     """Contains the old label before change"""
 
+    ExpressionStats: Final[dict[str, int]] = {}
+    """Statistics of the expression engine: Expressions, Evaluated and Skipped"""
+
     NoTouch: bool = False
     """Enable/disable no touch on any property change"""
 
@@ -1055,6 +1055,16 @@ Py::String DocumentObjectPy::getOldLabel() const
     return {getDocumentObjectPtr()->getOldLabel()};
 }
 
+Py::Dict DocumentObjectPy::getExpressionStats() const
+{
+    const auto& engine = getDocumentObjectPtr()->ExpressionEngine;
+    Py::Dict dict;
+    dict.setItem("Expressions", Py::Long(static_cast<unsigned long>(engine.numExpressions())));
+    dict.setItem("Evaluated", Py::Long(static_cast<unsigned long>(engine.getEvaluatedCount())));
+    dict.setItem("Skipped", Py::Long(static_cast<unsigned long>(engine.getSkippedCount())));
+    return dict;
+}
+
 Py::Boolean DocumentObjectPy::getNoTouch() const
 {
     return {getDocumentObjectPtr()->testStatus(ObjectStatus::NoTouch)};
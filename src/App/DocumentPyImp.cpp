@@ -29,9 +29,12 @@
 #include "Document.h"
 #include "DocumentObject.h"
 #include "DocumentObjectPy.h"
+#include "DocumentObserver.h"
 #include "DocumentSettings.h"
 #include "DocumentSettingsPy.h"
 #include "MergeDocuments.h"
+#include "RecomputeCache.h"
+#include "RecomputeProfiler.h"
 
 // inclusion of the generated files (generated By DocumentPy.xml)
 #include "DocumentPy.h"
@@ -649,6 +652,135 @@ PyObject* DocumentPy::commitTransaction(PyObject* args)
     Py_Return;
 }
 
+PyObject* DocumentPy::beginBulkUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->beginBulkUpdate();
+    Py_Return;
+}
+
+PyObject* DocumentPy::endBulkUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getDocumentPtr()->endBulkUpdate();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
+namespace
+{
+
+// The context manager returned by Document.bulkUpdate()
+// NOLINTNEXTLINE
+class BulkUpdatePy: public Py::PythonClass<BulkUpdatePy>
+{
+public:
+    static void init_type();
+
+    BulkUpdatePy(Py::PythonClassInstance* self, Py::Tuple& args, Py::Dict& kwds)
+        : Py::PythonClass<BulkUpdatePy>::PythonClass(self, args, kwds)
+    {
+        PyObject* pyDoc {};
+        if (!PyArg_ParseTuple(args.ptr(), "O!", &DocumentPy::Type, &pyDoc)) {
+            throw Py::Exception();
+        }
+        doc = std::make_unique<DocumentWeakPtrT>(static_cast<DocumentPy*>(pyDoc)->getDocumentPtr());
+    }
+
+    ~BulkUpdatePy() override
+    {
+        // the with statement was left without calling __exit__()
+        try {
+            end();
+        }
+        catch (Base::Exception& e) {
+            e.reportException();
+        }
+        catch (...) {
+            Base::Console().error("Unknown exception on ending bulk update\n");
+        }
+    }
+
+    Py::Object enter()
+    {
+        if (active) {
+            throw Py::RuntimeError("Bulk update already entered");
+        }
+        if (doc->expired()) {
+            throw Py::RuntimeError("Document was deleted");
+        }
+        (*doc)->beginBulkUpdate();
+        active = true;
+        return self();
+    }
+
+    Py::Object exit(const Py::Tuple& /*args*/)
+    {
+        try {
+            end();
+        }
+        catch (const Base::Exception& e) {
+            e.setPyException();
+            throw Py::Exception();
+        }
+        // do not suppress an exception raised inside the with statement
+        return Py::False();
+    }
+
+private:
+    void end()
+    {
+        if (!active) {
+            return;
+        }
+        active = false;
+        if (!doc->expired()) {
+            (*doc)->endBulkUpdate();
+        }
+    }
+
+    std::unique_ptr<DocumentWeakPtrT> doc;
+    bool active {false};
+};
+
+PYCXX_NOARGS_METHOD_DECL(BulkUpdatePy, enter)
+PYCXX_VARARGS_METHOD_DECL(BulkUpdatePy, exit)
+
+void BulkUpdatePy::init_type()
+{
+    behaviors().name("App.BulkUpdate");
+    behaviors().doc("Context manager for a bulk update of a document");
+    PYCXX_ADD_NOARGS_METHOD(__enter__, enter, "Begin the bulk update");
+    PYCXX_ADD_VARARGS_METHOD(__exit__, exit, "End the bulk update");
+    behaviors().readyType();
+}
+
+}  // namespace
+
+PyObject* DocumentPy::bulkUpdate(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        static const bool typeReady = (BulkUpdatePy::init_type(), true);
+        (void)typeReady;
+        Py::Callable type(reinterpret_cast<PyObject*>(BulkUpdatePy::type_object()));
+        Py::Tuple arg(1);
+        arg.setItem(0, Py::Object(this));
+        return Py::new_reference_to(type.apply(arg));
+    }
+    PY_CATCH;
+}
+
 Py::Boolean DocumentPy::getHasPendingTransaction() const
 {
     return {getDocumentPtr()->hasPendingTransaction()};
@@ -1218,6 +1350,23 @@ PyObject* DocumentPy::getBookedTransactionID(PyObject* args)
     return Py::new_reference_to(Py::Long(tid));
 }
 
+PyObject* DocumentPy::clearRecomputeCache(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    getDocumentPtr()->getRecomputeCache().clear();
+    Py_Return;
+}
+
+PyObject* DocumentPy::dumpRecomputeProfile(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    return Py::new_reference_to(Py::String(getDocumentPtr()->getRecomputeProfiler().toJson()));
+}
+
 
 Py::Boolean DocumentPy::getRestoring() const
 {
@@ -1253,3 +1402,66 @@ Py::Boolean DocumentPy::getTemporary() const
 {
     return {getDocumentPtr()->testStatus(Document::TempDoc)};
 }
+
+Py::Dict DocumentPy::getRecomputeCacheStats() const
+{
+    const auto& cache = getDocumentPtr()->getRecomputeCache();
+    Py::Dict dict;
+    dict.setItem("Hits", Py::Long(static_cast<unsigned long>(cache.getHits())));
+    dict.setItem("Misses", Py::Long(static_cast<unsigned long>(cache.getMisses())));
+    dict.setItem("Entries", Py::Long(static_cast<unsigned long>(cache.getEntryCount())));
+    dict.setItem("MemSize", Py::Long(static_cast<unsigned long>(cache.getMemSize())));
+    return dict;
+}
+
+Py::Dict DocumentPy::getMemoryUsage() const
+{
+    auto usage = getDocumentPtr()->getMemoryUsage();
+    // unsigned long has only 32 bits on Windows
+    auto toLong = [](std::size_t size) {
+        return Py::asObject(PyLong_FromSize_t(size));
+    };
+    Py::Dict objects;
+    for (const auto& [name, size] : usage.objects) {
+        objects.setItem(name, toLong(size));
+    }
+    Py::Dict propertyTypes;
+    for (const auto& [name, size] : usage.propertyTypes) {
+        propertyTypes.setItem(name, toLong(size));
+    }
+    Py::Dict dict;
+    dict.setItem("Total", toLong(usage.total()));
+    dict.setItem("Objects", objects);
+    dict.setItem("PropertyTypes", propertyTypes);
+    dict.setItem("DocumentProperties", toLong(usage.documentProperties));
+    dict.setItem("Undo", toLong(usage.undo));
+    dict.setItem("Redo", toLong(usage.redo));
+    dict.setItem("StringHasher", toLong(usage.stringHasher));
+    dict.setItem("ElementMaps", toLong(usage.elementMaps));
+    dict.setItem("RecomputeCache", toLong(usage.recomputeCache));
+    return dict;
+}
+
+Py::List DocumentPy::getRecomputeProfile() const
+{
+    Py::List list;
+    for (const auto& profile : getDocumentPtr()->getRecomputeProfiler().getHistory()) {
+        Py::List objects;
+        for (const auto& object : profile.objects) {
+            Py::Dict item;
+            item.setItem("Name", Py::String(object.name));
+            item.setItem("Label", Py::String(object.label));
+            item.setItem("Type", Py::String(object.type));
+            item.setItem("Time", Py::Float(object.time));
+            item.setItem("Executions", Py::Long(object.executions));
+            objects.append(item);
+        }
+        auto start = std::chrono::duration<double>(profile.start.time_since_epoch()).count();
+        Py::Dict dict;
+        dict.setItem("Start", Py::Float(start));
+        dict.setItem("Time", Py::Float(profile.time));
+        dict.setItem("Objects", objects);
+        list.append(dict);
+    }
+    return list;
+}
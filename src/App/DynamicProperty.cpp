@@ -22,9 +22,12 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <cstring>
+#include <functional>
 #include <map>
 #include <vector>
 #include <string>
+#include <string_view>
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -52,14 +55,16 @@ std::size_t CStringHasher::operator()(const char* s) const {
     if (!s) {
         return 0;
     }
-    return boost::hash_range(s, s + std::strlen(s));
+    return std::hash<std::string_view>()(s);
 }
 
 bool CStringHasher::operator()(const char* a, const char* b) const {
-    if (!a) {
-        return !b;
+    // Property names are usually passed as the pointer stored for the
+    // property, e.g. from Property::getName()
+    if (a == b) {
+        return true;
     }
-    if (!b) {
+    if (!a || !b) {
         return false;
     }
     return std::strcmp(a, b) == 0;
@@ -126,6 +131,9 @@ void DynamicProperty::getPropertyMap(std::map<std::string,Property*>& Map) const
 Property* DynamicProperty::getDynamicPropertyByName(const char* name) const
 {
     auto& index = impl->props.get<0>();
+    if (index.empty()) {
+        return nullptr;
+    }
     auto it = index.find(name);
     if (it != index.end()) {
         return it->property;
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
+#include <algorithm>
 #include <unordered_map>
 #ifndef FC_DEBUG
 #include <random>
@@ -277,6 +278,8 @@ ElementMapPtr ElementMap::restore(::App::StringHasherRef hasherRef,
                                   std::vector<ElementMapPtr>& childMaps,
                                   const std::vector<std::string>& postfixes)
 {
+    expand();
+
     const char* msg = "Invalid element map";
     const int hexBase {16};
     const int decBase {10};
@@ -511,6 +514,7 @@ MappedName ElementMap::addName(MappedName& name,
             FC_ERR("missing tag postfix " << name);  // NOLINT
         }
     }
+    expand();
     while (true) {
         if (overwrite) {
             erase(idx);
@@ -781,6 +785,7 @@ MappedName ElementMap::renameDuplicateElement(int index,
 
 void ElementMap::erase(const MappedName& name)
 {
+    expand();
     auto it = this->mappedNames.find(name);
     if (it == this->mappedNames.end()) {
         return;
@@ -795,6 +800,7 @@ void ElementMap::erase(const MappedName& name)
 
 void ElementMap::erase(const IndexedName& idx)
 {
+    expand();
     auto iter = this->indexedNames.find(idx.getType());
     if (iter == this->indexedNames.end()) {
         return;
@@ -812,16 +818,31 @@ void ElementMap::erase(const IndexedName& idx)
 
 unsigned long ElementMap::size() const
 {
-    return mappedNames.size() + childElementSize;
+    return mappedNames.size() + compactNames.size() + childElementSize;
 }
 
 bool ElementMap::empty() const
 {
-    return mappedNames.empty() && childElementSize == 0;
+    return mappedNames.empty() && compactNames.empty() && childElementSize == 0;
 }
 
 IndexedName ElementMap::find(const MappedName& name, ElementIDRefs* sids) const
 {
+    if (!compactNames.empty()) {
+        IndexedName idx;
+        if (const MappedNameRef* ref = findCompact(name, idx)) {
+            if (sids) {
+                if (sids->empty()) {
+                    *sids = ref->sids;
+                }
+                else {
+                    *sids += ref->sids;
+                }
+            }
+            return idx;
+        }
+    }
+
     auto nameIter = mappedNames.find(name);
     if (nameIter == mappedNames.end()) {
         if (childElements.isEmpty()) {
@@ -1000,6 +1021,95 @@ MappedNameRef* ElementMap::findMappedRef(const IndexedName& idx)
     return &indices.names[idx.getIndex()];
 }
 
+void ElementMap::compact()
+{
+    if (mappedNames.empty()) {
+        return;
+    }
+    expand();
+
+    // Shrinking reallocates the names, so it must happen before taking
+    // pointers to them
+    for (auto& indexedName : indexedNames) {
+        indexedName.second.names.shrink_to_fit();
+    }
+
+    // The names are already stored once per element, so only keep a pointer
+    // to them. The array inherits the order of the tree.
+    compactNames.reserve(mappedNames.size());
+    for (auto& [name, idx] : mappedNames) {
+        const MappedNameRef* ref = findMappedRef(idx);
+        for (; ref; ref = ref->next.get()) {
+            if (ref->name == name) {
+                break;
+            }
+        }
+        if (!ref) {
+            // Should not happen, but do not lose the name if it does
+            FC_ERR("missing element name reference " << idx << " -> " << name);  // NOLINT
+            compactNames.clear();
+            return;
+        }
+        compactNames.push_back({ref, idx});
+    }
+    mappedNames.clear();
+}
+
+bool ElementMap::isCompact() const
+{
+    return !compactNames.empty();
+}
+
+void ElementMap::expand()
+{
+    if (compactNames.empty()) {
+        return;
+    }
+    for (auto& compactName : compactNames) {
+        mappedNames.emplace_hint(mappedNames.end(), compactName.ref->name, compactName.idx);
+    }
+    compactNames.clear();
+    compactNames.shrink_to_fit();
+}
+
+const MappedNameRef* ElementMap::findCompact(const MappedName& name, IndexedName& idx) const
+{
+    auto it = std::lower_bound(compactNames.begin(),
+                               compactNames.end(),
+                               name,
+                               [](const CompactName& compactName, const MappedName& name) {
+                                   return compactName.ref->name < name;
+                               });
+    if (it == compactNames.end() || it->ref->name != name) {
+        return nullptr;
+    }
+    idx = it->idx;
+    return it->ref;
+}
+
+std::size_t ElementMap::getMemSize() const
+{
+    // A tree node holds three pointers and the color besides the value
+    constexpr std::size_t nodeSize = 4 * sizeof(void*);
+
+    std::size_t size = sizeof(ElementMap);
+    size += mappedNames.size() * (nodeSize + sizeof(decltype(mappedNames)::value_type));
+    size += compactNames.capacity() * sizeof(CompactName);
+    for (auto& indexedName : indexedNames) {
+        size += nodeSize + sizeof(decltype(indexedNames)::value_type);
+        for (auto& ref : indexedName.second.names) {
+            for (auto nameRef = &ref; nameRef; nameRef = nameRef->next.get()) {
+                size += sizeof(MappedNameRef) + nameRef->name.size()
+                    + nameRef->sids.size() * sizeof(App::StringIDRef);
+            }
+        }
+        size += indexedName.second.children.size()
+            * (nodeSize + sizeof(decltype(IndexedElements::children)::value_type));
+    }
+    size += childElements.size() * (sizeof(QByteArray) + sizeof(ChildMapInfo));
+    return size;
+}
+
 MappedNameRef& ElementMap::mappedRef(const IndexedName& idx)
 {
     assert(idx);
@@ -1079,6 +1189,9 @@ void ElementMap::collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
     for (auto& mappedName : this->mappedNames) {
         addPostfix(mappedName.first.constPostfix(), postfixMap, postfixes);
     }
+    for (auto& compactName : this->compactNames) {
+        addPostfix(compactName.ref->name.constPostfix(), postfixMap, postfixes);
+    }
 
     childMaps.push_back(this);
     res.first->second = (int)childMaps.size();
@@ -1310,6 +1423,9 @@ std::vector<MappedElement> ElementMap::getAll() const
     for (auto& mappedName : this->mappedNames) {
         ret.emplace_back(mappedName.first, mappedName.second);
     }
+    for (auto& compactName : this->compactNames) {
+        ret.emplace_back(compactName.ref->name, compactName.idx);
+    }
     for (auto& childElement : this->childElements) {
         auto& child = *childElement.childMap;
         IndexedName idx(child.indexedName);
@@ -36,6 +36,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 
 namespace Data
@@ -306,6 +307,28 @@ public:
      */
     void traceElement(const MappedName& name, long masterTag, TraceCallback cb) const;
 
+    /**
+     * @brief Switch to a compact representation of the name mapping.
+     *
+     * The tree mapping MappedName to IndexedName is replaced by a sorted
+     * array pointing to the names already stored per element, which takes a
+     * fraction of the memory. Meant to be called once the map is complete,
+     * e.g. when the shape is assigned to a property. Queries are unchanged,
+     * and the next modification switches back to the tree.
+     */
+    void compact();
+
+    /// Check if the map is in the compact representation.
+    bool isCompact() const;
+
+    /**
+     * @brief An estimate of the memory used by this map.
+     *
+     * Includes the mapped names and their string IDs, but not the child
+     * element maps or the shared string data of the hasher.
+     */
+    std::size_t getMemSize() const;
+
 
 private:
     /** Serialize this map
@@ -377,6 +400,12 @@ private:
 
     MappedNameRef& mappedRef(const IndexedName& idx);
 
+    /// Switch back from the compact representation before a modification.
+    void expand();
+
+    /// Find the entry of \c name in the compact representation.
+    const MappedNameRef* findCompact(const MappedName& name, IndexedName& idx) const;
+
     void collectChildMaps(std::map<const ElementMap*, int>& childMapSet,
                           std::vector<const ElementMap*>& childMaps,
                           std::map<QByteArray, int>& postfixMap,
@@ -401,6 +430,15 @@ private:
 
     std::map<MappedName, IndexedName, std::less<>> mappedNames;
 
+    /// The compact representation of mappedNames, sorted by name.
+    struct CompactName
+    {
+        const MappedNameRef* ref;
+        IndexedName idx;
+    };
+
+    std::vector<CompactName> compactNames;
+
     struct ChildMapInfo
     {
         int index = 0;
@@ -277,6 +277,21 @@ public:
 
     int priority() const override;
 
+    Expression* getCondition() const
+    {
+        return condition;
+    }
+
+    Expression* getTrueExpression() const
+    {
+        return trueExpr;
+    }
+
+    Expression* getFalseExpression() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -409,6 +424,24 @@ public:
     static Py::Object
     evaluate(const Expression* owner, int type, const std::vector<Expression*>& args);
 
+    /**
+     * @brief Evaluate a function taking quantity arguments and returning a quantity.
+     *
+     * This covers the arithmetic, trigonometric and rounding functions as
+     * well as NOT. It is shared by evaluate() and the compiled form of an
+     * expression.
+     *
+     * @param[in] owner The expression used in error messages.
+     * @param[in] type The function to evaluate.
+     * @param[in] args The function arguments.
+     * @param[in] count The number of arguments, at most three are used.
+     *
+     * @return The function result.
+     * @throws Base::ExpressionError if the arguments are invalid.
+     */
+    static Base::Quantity
+    evaluateNumeric(const Expression* owner, int type, const Base::Quantity* args, std::size_t count);
+
     Function getFunction() const
     {
         return f;
@@ -355,6 +355,12 @@ public:
         return imp->supportsAsyncRecompute() == FeaturePythonImp::Accepted;
     }
 
+    bool canRecomputeConcurrently() const override
+    {
+        // Python features must hold the GIL while executing.
+        return false;
+    }
+
     /**
      * @brief Called when a property is edited by the user.
      *
@@ -226,6 +226,9 @@ DocumentObjectExecReturn* FeatureTest::execute()
             throw std::runtime_error("Test Exception");
         case 2:
             throw Base::RuntimeError("FeatureTestException::execute(): Testexception");
+        case 3:
+            // not derived from std::exception
+            throw 3;  // NOLINT
         default:
             (void)i;
             (void)j;
@@ -111,6 +111,14 @@ public:
     short mustExecute() const override;
     /// recalculate the Feature
     DocumentObjectExecReturn* execute() override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
+    bool canCacheRecompute() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     // Hint: Probably it makes sense to have a view provider for unittests (e.g.
     // Gui::ViewProviderTest)
@@ -22,6 +22,7 @@
  *                                                                          *
  ****************************************************************************/
 
+#include <algorithm>
 #include <limits>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -69,6 +70,7 @@ public:
     std::unordered_map<const char *,void(*)(LinkParamsP*),App::CStringHasher,App::CStringHasher> funcs;
 
     bool CopyOnChangeApplyToAll;
+    long CompactArrayThreshold;
 
     // Auto generated code (App/params_utils.py:247)
     LinkParamsP() {
@@ -77,6 +79,8 @@ public:
 
         CopyOnChangeApplyToAll = handle->GetBool("CopyOnChangeApplyToAll", true);
         funcs["CopyOnChangeApplyToAll"] = &LinkParamsP::updateCopyOnChangeApplyToAll;
+        CompactArrayThreshold = handle->GetInt("CompactArrayThreshold", 0);
+        funcs["CompactArrayThreshold"] = &LinkParamsP::updateCompactArrayThreshold;
     }
 
     // Auto generated code (App/params_utils.py:265)
@@ -99,6 +103,10 @@ public:
     static void updateCopyOnChangeApplyToAll(LinkParamsP *self) {
         self->CopyOnChangeApplyToAll = self->handle->GetBool("CopyOnChangeApplyToAll", true);
     }
+    // Auto generated code (App/params_utils.py:290)
+    static void updateCompactArrayThreshold(LinkParamsP *self) {
+        self->CompactArrayThreshold = self->handle->GetInt("CompactArrayThreshold", 0);
+    }
 };
 
 // Auto generated code (App/params_utils.py:312)
@@ -142,6 +150,36 @@ void LinkParams::setCopyOnChangeApplyToAll(const bool &v) {
 void LinkParams::removeCopyOnChangeApplyToAll() {
     instance()->handle->RemoveBool("CopyOnChangeApplyToAll");
 }
+
+// Auto generated code (App/params_utils.py:352)
+const char *LinkParams::docCompactArrayThreshold() {
+    return QT_TRANSLATE_NOOP("LinkParams",
+"Link arrays with more elements than this number collapse their elements, i.e.\n"
+"keep the element placements, scales and visibilities in the link itself and\n"
+"only create element objects on demand. Zero disables the automatic collapsing.");
+}
+
+// Auto generated code (App/params_utils.py:360)
+const long & LinkParams::getCompactArrayThreshold() {
+    return instance()->CompactArrayThreshold;
+}
+
+// Auto generated code (App/params_utils.py:368)
+const long & LinkParams::defaultCompactArrayThreshold() {
+    const static long def = 0;
+    return def;
+}
+
+// Auto generated code (App/params_utils.py:377)
+void LinkParams::setCompactArrayThreshold(const long &v) {
+    instance()->handle->SetInt("CompactArrayThreshold",v);
+    instance()->CompactArrayThreshold = v;
+}
+
+// Auto generated code (App/params_utils.py:386)
+void LinkParams::removeCompactArrayThreshold() {
+    instance()->handle->RemoveInt("CompactArrayThreshold");
+}
 //[[[end]]]
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1093,6 +1131,9 @@ bool LinkBaseExtension::extensionHasChildElement() const
 int LinkBaseExtension::extensionSetElementVisible(const char* element, bool visible)
 {
     int index = _getShowElementValue() ? getElementIndex(element) : getArrayIndex(element);
+    if (index < 0 && !_getShowElementValue()) {
+        index = getElementObjectIndex(element);
+    }
     if (index >= 0) {
         auto propElementVis = getVisibilityListProperty();
         if (!propElementVis || !element || !element[0]) {
@@ -1116,6 +1157,9 @@ int LinkBaseExtension::extensionSetElementVisible(const char* element, bool visi
                 myHiddenElements.erase(elements[index]);
             }
         }
+        else {
+            syncElementObjects();
+        }
         return 1;
     }
     DocumentObject* linked = getTrueLinkedObject(false);
@@ -1128,6 +1172,9 @@ int LinkBaseExtension::extensionSetElementVisible(const char* element, bool visi
 int LinkBaseExtension::extensionIsElementVisible(const char* element)
 {
     int index = _getShowElementValue() ? getElementIndex(element) : getArrayIndex(element);
+    if (index < 0 && !_getShowElementValue()) {
+        index = getElementObjectIndex(element);
+    }
     if (index >= 0) {
         auto propElementVis = getVisibilityListProperty();
         if (propElementVis) {
@@ -1640,6 +1687,7 @@ void LinkBaseExtension::onExtendedUnsetupObject()
     if (!getElementListProperty()) {
         return;
     }
+    releaseElementObjects();
     detachElements();
     if (auto obj = getLinkCopyOnChangeGroupValue()) {
         if (obj->isAttachedToDocument() && !obj->isRemoving()) {
@@ -1702,6 +1750,10 @@ void LinkBaseExtension::extensionOnChanged(const Property* prop)
     auto parent = getContainer();
     if (parent && !parent->isRestoring() && prop && !prop->testStatus(Property::User3)) {
         update(parent, prop);
+        if (prop == getPlacementProperty() || prop == getLinkPlacementProperty()
+            || prop == getScaleProperty() || prop == getScaleVectorProperty()) {
+            onElementObjectChanged();
+        }
     }
     inherited::extensionOnChanged(prop);
 }
@@ -1861,7 +1913,18 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
     }
     else if (prop == _getShowElementProperty()) {
         if (_getShowElementValue()) {
+            // The element objects created on demand are reclaimed as elements
+            // by name, remove any that are not.
+            auto objs = getElementObjects();
+            myElementObjects.clear();
             update(parent, _getElementCountProperty());
+            const auto& elements = _getElementListValue();
+            for (const auto& [index, obj] : objs) {
+                if (std::find(elements.begin(), elements.end(), obj) == elements.end()
+                    && obj->isAttachedToDocument()) {
+                    obj->getDocument()->removeObject(obj->getNameInDocument());
+                }
+            }
         }
         else {
             auto objs = getElementListValue();
@@ -1910,6 +1973,13 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
     else if (prop == _getElementCountProperty()) {
         size_t elementCount = getElementCountValue() < 0 ? 0 : (size_t)getElementCountValue();
 
+        long threshold = LinkParams::getCompactArrayThreshold();
+        if (threshold > 0 && elementCount > (size_t)threshold && _getShowElementValue()
+            && getShowElementProperty() && !parent->getDocument()->isPerformingTransaction()) {
+            // Collapse large arrays instead of creating an object per element
+            getShowElementProperty()->setValue(false);
+        }
+
         auto propVis = getVisibilityListProperty();
         if (propVis) {
             if (propVis->getSize() > (int)elementCount) {
@@ -1940,6 +2010,7 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
                 getPlacementListProperty()->setValue(placements);
                 getPlacementListProperty()->setStatus(Property::User3, false);
             }
+            releaseElementObjects(static_cast<int>(elementCount));
         }
         else if (getElementListProperty()) {
             auto objs = getElementListValue();
@@ -2039,6 +2110,9 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
                 }
             }
         }
+        else {
+            syncElementObjects();
+        }
     }
     else if (prop == getElementListProperty() || prop == &_ChildCache) {
 
@@ -2144,6 +2218,9 @@ void LinkBaseExtension::update(App::DocumentObject* parent, const Property* prop
         syncElementList();
     }
     else {
+        if (prop == getPlacementListProperty() || prop == getScaleListProperty()) {
+            syncElementObjects();
+        }
         checkCopyOnChange(parent, *prop);
     }
 }
@@ -2174,6 +2251,17 @@ bool LinkBaseExtension::linkTransform() const
 }
 
 void LinkBaseExtension::syncElementList()
+{
+    auto elements = getElementListValue();
+    for (auto i : elements) {
+        syncElement(freecad_cast<LinkElement*>(i));
+    }
+    for (const auto& [index, obj] : getElementObjects()) {
+        syncElement(static_cast<LinkElement*>(obj));
+    }
+}
+
+void LinkBaseExtension::syncElement(LinkElement* element)
 {
     auto transform = getLinkTransformProperty();
     auto link = getLinkedObjectProperty();
@@ -2181,36 +2269,216 @@ void LinkBaseExtension::syncElementList()
 
     auto owner = getContainer();
     auto ownerID = owner ? owner->getID() : 0;
-    auto elements = getElementListValue();
-    for (auto i : elements) {
-        auto element = freecad_cast<LinkElement*>(i);
-        if (!element
-            || (element->_LinkOwner.getValue() && element->_LinkOwner.getValue() != ownerID)) {
-            continue;
+    if (!element
+        || (element->_LinkOwner.getValue() && element->_LinkOwner.getValue() != ownerID)) {
+        return;
+    }
+
+    element->_LinkOwner.setValue(ownerID);
+
+    element->LinkTransform.setStatus(Property::Hidden, transform != nullptr);
+    element->LinkTransform.setStatus(Property::Immutable, transform != nullptr);
+    if (transform && element->LinkTransform.getValue() != transform->getValue()) {
+        element->LinkTransform.setValue(transform->getValue());
+    }
+
+    element->LinkedObject.setStatus(Property::Hidden, link != nullptr);
+    element->LinkedObject.setStatus(Property::Immutable, link != nullptr);
+    if (element->LinkCopyOnChange.getValue() == 2) {
+        return;
+    }
+    if (xlink) {
+        if (element->LinkedObject.getValue() != xlink->getValue()
+            || element->LinkedObject.getSubValues() != xlink->getSubValues()) {
+            element->LinkedObject.setValue(xlink->getValue(), xlink->getSubValues());
+        }
+    }
+    else if (element->LinkedObject.getValue() != link->getValue()
+             || !element->LinkedObject.getSubValues().empty()) {
+        element->setLink(-1, link->getValue());
+    }
+}
+
+DocumentObject* LinkBaseExtension::getElementObject(int index, bool create)
+{
+    if (index < 0) {
+        return nullptr;
+    }
+    if (_getShowElementValue() || !_getElementCountValue()) {
+        const auto& elements = _getElementListValue();
+        return index < (int)elements.size() ? elements[index] : nullptr;
+    }
+    auto owner = getContainer();
+    if (!owner || !owner->isAttachedToDocument() || index >= _getElementCountValue()) {
+        return nullptr;
+    }
+
+    auto objs = getElementObjects();
+    auto it = objs.find(index);
+    if (it != objs.end()) {
+        return it->second;
+    }
+
+    // Use the same naming as the element objects of an expanded array, so
+    // that they are reclaimed when the array is expanded.
+    std::string name(owner->getNameInDocument());
+    name += "_i";
+    name += std::to_string(index);
+    auto doc = owner->getDocument();
+    auto obj = doc->getObject(name.c_str());
+    auto element = freecad_cast<LinkElement*>(obj);
+    if (!element || element->_LinkOwner.getValue() != owner->getID()) {
+        if (obj || !create) {
+            return nullptr;
         }
+        element = new LinkElement;
+        doc->addObject(element, name.c_str());
+        element->Visibility.setValue(false);
+    }
+    myElementObjects[index] = element->getID();
+    syncElement(element);
+    Base::StateLocker guard(syncingElementObjects);
+    if (auto prop = getPlacementListProperty(); prop && prop->getSize() > index) {
+        element->Placement.setValue(prop->getValues()[index]);
+    }
+    if (auto prop = getScaleListProperty(); prop && prop->getSize() > index) {
+        element->ScaleVector.setValue(prop->getValues()[index]);
+    }
+    const auto& vis = getVisibilityListValue();
+    if ((int)vis.size() > index && !vis[index]) {
+        myHiddenElements.insert(element);
+    }
+    return element;
+}
 
-        element->_LinkOwner.setValue(ownerID);
+std::map<int, DocumentObject*> LinkBaseExtension::getElementObjects() const
+{
+    std::map<int, DocumentObject*> res;
+    auto owner = getContainer();
+    if (!owner || !owner->isAttachedToDocument()) {
+        return res;
+    }
+    for (const auto& [index, id] : myElementObjects) {
+        auto element = freecad_cast<LinkElement*>(owner->getDocument()->getObjectByID(id));
+        if (element && !element->isRemoving()
+            && element->_LinkOwner.getValue() == owner->getID()) {
+            res.emplace(index, element);
+        }
+    }
+    return res;
+}
 
-        element->LinkTransform.setStatus(Property::Hidden, transform != nullptr);
-        element->LinkTransform.setStatus(Property::Immutable, transform != nullptr);
-        if (transform && element->LinkTransform.getValue() != transform->getValue()) {
-            element->LinkTransform.setValue(transform->getValue());
+void LinkBaseExtension::releaseElementObjects(int first)
+{
+    std::vector<App::DocumentObjectT> objs;
+    for (const auto& [index, obj] : getElementObjects()) {
+        if (index >= first) {
+            objs.emplace_back(obj);
+        }
+    }
+    myElementObjects.erase(myElementObjects.lower_bound(first), myElementObjects.end());
+    for (const auto& objT : objs) {
+        if (auto obj = objT.getObject()) {
+            obj->getDocument()->removeObject(obj->getNameInDocument());
         }
+    }
+}
 
-        element->LinkedObject.setStatus(Property::Hidden, link != nullptr);
-        element->LinkedObject.setStatus(Property::Immutable, link != nullptr);
-        if (element->LinkCopyOnChange.getValue() == 2) {
-            continue;
+void LinkBaseExtension::syncElementObjects()
+{
+    if (syncingElementObjects || _getShowElementValue()) {
+        return;
+    }
+    Base::StateLocker guard(syncingElementObjects);
+    auto placementProp = getPlacementListProperty();
+    auto scaleProp = getScaleListProperty();
+    const auto& vis = getVisibilityListValue();
+    myHiddenElements.clear();
+    for (const auto& [index, obj] : getElementObjects()) {
+        auto element = static_cast<LinkElement*>(obj);
+        if ((int)vis.size() > index && !vis[index]) {
+            myHiddenElements.insert(element);
         }
-        if (xlink) {
-            if (element->LinkedObject.getValue() != xlink->getValue()
-                || element->LinkedObject.getSubValues() != xlink->getSubValues()) {
-                element->LinkedObject.setValue(xlink->getValue(), xlink->getSubValues());
-            }
+        if (placementProp && placementProp->getSize() > index
+            && element->Placement.getValue() != placementProp->getValues()[index]) {
+            element->Placement.setValue(placementProp->getValues()[index]);
+        }
+        if (scaleProp && scaleProp->getSize() > index
+            && element->ScaleVector.getValue() != scaleProp->getValues()[index]) {
+            element->ScaleVector.setValue(scaleProp->getValues()[index]);
         }
-        else if (element->LinkedObject.getValue() != link->getValue()
-                 || !element->LinkedObject.getSubValues().empty()) {
-            element->setLink(-1, link->getValue());
+    }
+}
+
+int LinkBaseExtension::getElementObjectIndex(const char* name) const
+{
+    if (!name || !name[0]) {
+        return -1;
+    }
+    for (const auto& [index, obj] : getElementObjects()) {
+        if (strcmp(obj->getNameInDocument(), name) == 0) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+void LinkBaseExtension::writeElementObject(const LinkElement* element, int index)
+{
+    Base::StateLocker guard(syncingElementObjects);
+    auto placementProp = getPlacementListProperty();
+    if (placementProp && placementProp->getSize() > index
+        && placementProp->getValues()[index] != element->Placement.getValue()) {
+        placementProp->set1Value(index, element->Placement.getValue());
+    }
+    auto scaleProp = getScaleListProperty();
+    if (scaleProp && scaleProp->getSize() > index
+        && scaleProp->getValues()[index] != element->getScaleVector()) {
+        scaleProp->set1Value(index, element->getScaleVector());
+    }
+}
+
+void LinkBaseExtension::onElementObjectChanged()
+{
+    auto element = freecad_cast<LinkElement*>(getContainer());
+    if (!element || !_LinkOwner.getValue() || !element->isAttachedToDocument()) {
+        return;
+    }
+    auto owner = element->getDocument()->getObjectByID(_LinkOwner.getValue());
+    auto ext = owner ? owner->getExtensionByType<LinkBaseExtension>(true) : nullptr;
+    if (!ext || ext->syncingElementObjects || ext->_getShowElementValue()) {
+        return;
+    }
+    for (const auto& [index, id] : ext->myElementObjects) {
+        if (id == element->getID()) {
+            ext->writeElementObject(element, index);
+            return;
+        }
+    }
+}
+
+void LinkBaseExtension::registerElementObject()
+{
+    auto element = freecad_cast<LinkElement*>(getContainer());
+    if (!element || !_LinkOwner.getValue() || !element->isAttachedToDocument()) {
+        return;
+    }
+    auto owner = element->getDocument()->getObjectByID(_LinkOwner.getValue());
+    auto ext = owner ? owner->getExtensionByType<LinkBaseExtension>(true) : nullptr;
+    if (!ext || ext->_getShowElementValue() || !ext->_getElementCountValue()) {
+        return;
+    }
+    std::string prefix(owner->getNameInDocument());
+    prefix += "_i";
+    const char* name = element->getNameInDocument();
+    if (boost::starts_with(name, prefix)) {
+        int index = getArrayIndex(name + prefix.size());
+        if (index >= 0 && index < ext->_getElementCountValue()) {
+            ext->myElementObjects[index] = element->getID();
+            const auto& vis = ext->getVisibilityListValue();
+            if ((int)vis.size() > index && !vis[index]) {
+                ext->myHiddenElements.insert(element);
+            }
         }
     }
 }
@@ -2223,6 +2491,9 @@ void LinkBaseExtension::onExtendedDocumentRestored()
     if (!parent) {
         return;
     }
+    registerElementObject();
+    // the element objects restored before this array registered already
+    syncElementObjects();
     if (hasOldSubElement) {
         hasOldSubElement = false;
         // SubElements was stored as a PropertyStringList. It is now migrated to be
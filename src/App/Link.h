@@ -27,6 +27,7 @@
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <map>
 #include <unordered_set>
 #include <Base/Parameter.h>
 #include <Base/Bitmask.h>
@@ -53,6 +54,8 @@
 namespace App
 {
 
+class LinkElement;
+
 /**
  * @brief The base class of the link extension.
  * @ingroup LinksGroup
@@ -541,6 +544,40 @@ public:
      */
     void elementNameFromIndex(int idx, std::ostream& ss) const;
 
+    /**
+     * @brief Get the object of an array element.
+     *
+     * If the elements are collapsed, i.e. ShowElement is false, their
+     * placement, scale and visibility are only kept in the PlacementList,
+     * ScaleList and VisibilityList of this link and no element objects exist.
+     * In this case an element object is created on demand, e.g. to select or
+     * modify a single element. Changes of its placement and scale are written
+     * back to the lists, which remain the storage of the element. Its
+     * visibility is looked up in VisibilityList, also when it is queried or
+     * changed by the name of the element object.
+     *
+     * @param[in] index The array index of the element.
+     * @param[in] create Whether to create a missing element object of a
+     * collapsed array.
+     *
+     * @return The element object or @c nullptr if there is none.
+     */
+    DocumentObject* getElementObject(int index, bool create = true);
+
+    /**
+     * @brief Get the element objects created on demand.
+     *
+     * @return The element objects of a collapsed array mapped by their array index.
+     */
+    std::map<int, DocumentObject*> getElementObjects() const;
+
+    /**
+     * @brief Remove the element objects created on demand.
+     *
+     * @param[in] first The array index of the first element object to remove.
+     */
+    void releaseElementObjects(int first = 0);
+
     /// Get the container object of this link.
     DocumentObject* getContainer();
     /// Get the container object of this link (const version).
@@ -752,6 +789,24 @@ protected:
     /// Sync the link elements in this link.
     void syncElementList();
 
+    /// Sync the linked object of a link element with this link.
+    void syncElement(LinkElement* element);
+
+    /// Sync the element objects of a collapsed array with the element lists.
+    void syncElementObjects();
+
+    /// Get the array index of the element object with the given name, or -1.
+    int getElementObjectIndex(const char* name) const;
+
+    /// Write the placement and scale of an element object back to the element lists.
+    void writeElementObject(const LinkElement* element, int index);
+
+    /// Notify the owner array of a change of this element object.
+    void onElementObjectChanged();
+
+    /// Register this element object with the owner array after restoring.
+    void registerElementObject();
+
     /**
      * @brief Detach a linked element.
      *
@@ -833,6 +888,12 @@ protected:
 
     /// Connection for monitoring changes on the copy on change source.
     fastsignals::scoped_connection connCopyOnChangeSource;
+
+    /// The IDs of the element objects created on demand mapped by array index.
+    std::map<int, long> myElementObjects;
+
+    /// Whether the element objects are being synchronized.
+    bool syncingElementObjects = false;
 };
 
 ///////////////////////////////////////////////////////////////////////////
@@ -1204,6 +1265,21 @@ public:
     static const char *docCopyOnChangeApplyToAll();
     /// @}
 
+    // Auto generated code (App/params_utils.py:139)
+    /// @name CompactArrayThreshold accessors
+    /// @brief Accessors for parameter CompactArrayThreshold
+    ///
+    /// Link arrays with more elements than this number collapse their elements, i.e.
+    /// keep the element placements, scales and visibilities in the link itself and
+    /// only create element objects on demand. Zero disables the automatic collapsing.
+    /// @{
+    static const long & getCompactArrayThreshold();
+    static const long & defaultCompactArrayThreshold();
+    static void removeCompactArrayThreshold();
+    static void setCompactArrayThreshold(const long &v);
+    static const char *docCompactArrayThreshold();
+    /// @}
+
 // Auto generated code (App/params_utils.py:180)
 }; // class LinkParams
 } // namespace App
@@ -117,3 +117,19 @@ class LinkBaseExtension(DocumentObjectExtension):
         Return an expanded subname in case it references an object inside a linked plain group
         """
         ...
+
+    def getElementObject(self, index: int, create: bool = True, /) -> Any:
+        """
+        getElementObject(index, create=True): return the object of an array element
+
+        If the array elements are collapsed (ShowElement is False), the element object
+        is created on demand if 'create' is True. Its placement and scale changes are
+        written back to PlacementList and ScaleList of the link.
+        """
+        ...
+
+    def releaseElementObjects(self) -> None:
+        """
+        Remove the element objects created on demand for collapsed array elements
+        """
+        ...
@@ -317,6 +317,37 @@ PyObject* LinkBaseExtensionPy::expandSubname(PyObject* args)
     PY_CATCH;
 }
 
+PyObject* LinkBaseExtensionPy::getElementObject(PyObject* args)
+{
+    int index;
+    PyObject* create = Py_True;
+    if (!PyArg_ParseTuple(args, "i|O", &index, &create)) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        auto obj = getLinkBaseExtensionPtr()->getElementObject(index, Base::asBoolean(create));
+        if (!obj) {
+            Py_Return;
+        }
+        return obj->getPyObject();
+    }
+    PY_CATCH;
+}
+
+PyObject* LinkBaseExtensionPy::releaseElementObjects(PyObject* args)
+{
+    if (!PyArg_ParseTuple(args, "")) {
+        return nullptr;
+    }
+    PY_TRY
+    {
+        getLinkBaseExtensionPtr()->releaseElementObjects();
+        Py_Return;
+    }
+    PY_CATCH;
+}
+
 Py::List LinkBaseExtensionPy::getLinkedChildren() const
 {
     Py::List ret;
@@ -26,6 +26,14 @@ Params = [
 Stores the last user choice of whether to apply CopyOnChange setup to all link
 that links to the same configurable object""",
     ),
+    ParamInt(
+        "CompactArrayThreshold",
+        0,
+        """\
+Link arrays with more elements than this number collapse their elements, i.e.
+keep the element placements, scales and visibilities in the link itself and
+only create element objects on demand. Zero disables the automatic collapsing.""",
+    ),
 ]
 
 
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <sstream>
+
+#include <Base/Console.h>
+#include <Base/Exception.h>
+#include <Base/Reader.h>
+#include <Base/Tools.h>
+
+#include "ParallelRestore.h"
+#include "DocumentObject.h"
+
+
+FC_LOG_LEVEL_INIT("App", true, true)
+
+using namespace App;
+
+namespace
+{
+
+// Only used from the thread reading the document.
+ParallelRestore* activeRestore = nullptr;
+
+}  // namespace
+
+ParallelRestore::ParallelRestore(const Base::XMLReader& reader)
+    : documentSchema(reader.DocumentSchema)
+    , programVersion(reader.ProgramVersion)
+    , fileVersion(reader.FileVersion)
+    , previous(activeRestore)
+{
+    activeRestore = this;
+}
+
+ParallelRestore::~ParallelRestore()
+{
+    activeRestore = previous;
+}
+
+ParallelRestore* ParallelRestore::active()
+{
+    return activeRestore;
+}
+
+bool ParallelRestore::defer(Property* prop, Base::XMLReader& reader)
+{
+    // Other containers, e.g. temporary ones, may not live until apply().
+    if (!prop->canRestoreConcurrently()
+        || !freecad_cast<DocumentObject*>(prop->getContainer())) {
+        return false;
+    }
+
+    Entry entry;
+    entry.prop = prop;
+    entry.copy.reset(prop->Copy());
+    reader.beginCapture();
+    reader.readEndElement("Property");
+    entry.xml = reader.endCapture();
+    entries.push_back(std::move(entry));
+    return true;
+}
+
+std::size_t ParallelRestore::size() const
+{
+    return entries.size();
+}
+
+void ParallelRestore::restore(std::size_t index)
+{
+    auto& entry = entries[index];
+    try {
+        std::istringstream str(entry.xml);
+        Base::XMLReader reader("Document.xml", str);
+        reader.DocumentSchema = documentSchema;
+        reader.ProgramVersion = programVersion;
+        reader.FileVersion = fileVersion;
+        reader.readElement("Property");
+        entry.copy->Restore(reader);
+        if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestoreInProperty)) {
+            entry.partial = true;
+        }
+    }
+    catch (const Base::XMLParseException&) {
+        entry.exception = std::current_exception();
+    }
+    catch (const Base::RestoreError&) {
+        entry.partial = true;
+    }
+    catch (const Base::Exception& e) {
+        entry.error = e.what();
+    }
+    catch (const std::exception& e) {
+        entry.error = e.what();
+    }
+    catch (...) {
+        // An exception must not leave the worker thread, apply() rethrows it
+        entry.exception = std::current_exception();
+    }
+}
+
+void ParallelRestore::apply(Base::XMLReader& reader)
+{
+    for (auto& entry : entries) {
+        auto prop = entry.prop;
+        auto obj = static_cast<DocumentObject*>(prop->getContainer());
+        if (entry.exception) {
+            auto exception = entry.exception;
+            entries.clear();
+            std::rethrow_exception(exception);
+        }
+        if (!entry.error.empty()) {
+            Base::Console().error("%s\n", entry.error.c_str());
+            continue;
+        }
+
+        FC_TRACE("paste restored property '" << prop->getFullName() << "'");
+        {
+            Base::ObjectStatusLocker<ObjectStatus, DocumentObject> guard(ObjectStatus::Restore, obj);
+            prop->Paste(*entry.copy);
+        }
+
+        if (entry.partial) {
+            reader.setPartialRestore(true);
+            reader.clearPartialRestoreDocumentObject();
+            Base::Console().error("Property %s of type %s was subject to a partial restore.\n",
+                                  prop->getName(),
+                                  prop->getTypeId().getName());
+            Base::Console().error("Object \"%s\" was subject to a partial restore. As a "
+                                  "result geometry may have changed or be incomplete.\n",
+                                  obj->getNameInDocument());
+        }
+    }
+    entries.clear();
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace Base
+{
+class XMLReader;
+}
+
+namespace App
+{
+
+class Property;
+
+/**
+ * @brief Restores the properties of a document in worker threads.
+ *
+ * While an instance is active, PropertyContainer::Restore() hands every
+ * property that returns true from Property::canRestoreConcurrently() to it
+ * instead of restoring the property directly. The XML element of the property
+ * is recorded, and restore() later reads it into a detached copy of the
+ * property. Different properties can be restored concurrently. apply() then
+ * pastes the copies into the original properties in the order they have been
+ * recorded, so that all change notifications happen in the calling thread and
+ * in document order.
+ */
+class AppExport ParallelRestore
+{
+public:
+    /**
+     * @brief Construct a parallel restore and make it the active one.
+     *
+     * @param[in] reader The reader of the document, whose version information
+     * is passed on to the readers of the recorded properties.
+     */
+    explicit ParallelRestore(const Base::XMLReader& reader);
+    ~ParallelRestore();
+
+    ParallelRestore(const ParallelRestore&) = delete;
+    ParallelRestore(ParallelRestore&&) = delete;
+    ParallelRestore& operator=(const ParallelRestore&) = delete;
+    ParallelRestore& operator=(ParallelRestore&&) = delete;
+
+    /// The active instance or nullptr if properties are restored directly.
+    static ParallelRestore* active();
+
+    /**
+     * @brief Record a property for a later restore.
+     *
+     * The reader must be positioned on the \<Property\> element of the
+     * property. If the property is recorded, the reader is moved to the end of
+     * the element.
+     *
+     * @param[in] prop The property to restore.
+     * @param[in] reader The reader of the document.
+     * @return True if the property has been recorded, false if it must be
+     * restored directly.
+     */
+    bool defer(Property* prop, Base::XMLReader& reader);
+
+    /// The number of recorded properties.
+    std::size_t size() const;
+
+    /**
+     * @brief Restore a recorded property into its copy.
+     *
+     * It is safe to call this function from several threads as long as the
+     * indices differ.
+     *
+     * @param[in] index The index of the recorded property.
+     */
+    void restore(std::size_t index);
+
+    /**
+     * @brief Paste the restored copies into their properties.
+     *
+     * Errors of the restore are reported in the same way and order as if the
+     * properties had been restored directly. An XML parse error or an unknown
+     * exception thrown while restoring a property is rethrown here.
+     *
+     * @param[in] reader The reader of the document, which receives the
+     * partial restore status.
+     */
+    void apply(Base::XMLReader& reader);
+
+private:
+    struct Entry
+    {
+        Property* prop;
+        std::string xml;
+        std::unique_ptr<Property> copy;
+        std::string error;
+        std::exception_ptr exception;
+        bool partial {false};
+    };
+
+    std::vector<Entry> entries;
+    int documentSchema;
+    std::string programVersion;
+    int fileVersion;
+    ParallelRestore* previous;
+};
+
+}  // namespace App
@@ -27,10 +27,12 @@
 
 #include <Base/Exception.h>
 #include <Base/Persistence.h>
+#include <Base/SharedVector.h>
 #include <boost/any.hpp>
 #include <fastsignals/signal.h>
 #include <bitset>
 #include <string>
+#include <type_traits>
 #include <FCGlobal.h>
 
 #include "ElementNamingUtils.h"
@@ -359,6 +361,22 @@ public:
      */
     virtual void onContainerRestored() {}
 
+    /**
+     * @brief Whether the property can be restored concurrently.
+     *
+     * If it returns true, a parallel document restore may read the property
+     * into a detached copy in a worker thread and paste the result afterwards.
+     * This requires that Restore() only uses the passed XML element, i.e. it
+     * neither registers files with the reader nor uses its name mapping, and
+     * that Copy() and Paste() transfer the complete restored state.
+     *
+     * @return True if the property can be restored in a worker thread.
+     */
+    virtual bool canRestoreConcurrently() const
+    {
+        return false;
+    }
+
     /** Property status handling
      */
     //@{
@@ -893,6 +911,9 @@ public:
  * This class combines property storage (via a standard container ListT) with
  * the change-notification interface in AtomicPropertyChangeInterface.
  *
+ * If ListT is a @c std::vector<T> the values are kept in a Base::SharedVector,
+ * so copies of the property share the values until either one is modified.
+ *
  * @tparam T       The type of individual property values.
  * @tparam ListT   The container type for holding values (defaults to @c std::vector<T>).
  * @tparam ParentT The base class providing core property-list behavior
@@ -912,6 +933,11 @@ public:
     /// The base class type.
     using parent_type = ParentT;
 
+    /// The type used to store the values.
+    using storage_type = std::conditional_t<std::is_same_v<ListT, std::vector<T>>,
+                                            Base::SharedVector<T>,
+                                            ListT>;
+
     /**
      * @brief Helper type for performing atomic property changes.
      *
@@ -1111,6 +1137,23 @@ public:
     }
 
 protected:
+    /**
+     * @brief Replace the entire list of values with the ones of another list.
+     *
+     * Unlike setValues() this shares the storage of @p other instead of
+     * copying it. It is meant for Paste() of lists that do not override
+     * setValues().
+     *
+     * @param[in] other  The list to take the values from.
+     */
+    void shareValues(const PropertyListsT& other)
+    {
+        atomic_change guard(*this);
+        this->_touchList.clear();
+        this->_lValueList = other._lValueList;
+        guard.tryInvoke();
+    }
+
     void setPyValues(const std::vector<PyObject*>& vals, const std::vector<int>& indices) override
     {
         if (indices.empty()) {
@@ -1142,7 +1185,26 @@ protected:
     virtual T getPyValue(PyObject* item) const = 0;
 
 protected:
-    ListT _lValueList;
+    /**
+     * @brief Get the part of the memory of the values charged to this list.
+     *
+     * Copies of the list, e.g. in undo transactions, share the values until
+     * either one is modified. The size of a shared buffer is divided among
+     * its owners, so adding up the sizes of all lists counts it only once.
+     *
+     * @param[in] size  The memory size of all values.
+     *
+     * @return The memory size charged to this list.
+     */
+    unsigned int getSharedMemSize(std::size_t size) const
+    {
+        if constexpr (std::is_same_v<storage_type, Base::SharedVector<T>>) {
+            size /= _lValueList.useCount();
+        }
+        return static_cast<unsigned int>(size);
+    }
+
+    storage_type _lValueList;
 };
 
 }  // namespace App
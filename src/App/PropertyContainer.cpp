@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <cstring>
 #include <map>
 #include <vector>
 #include <string>
@@ -37,6 +38,7 @@
 #include <Base/Reader.h>
 #include <Base/Writer.h>
 
+#include "ParallelRestore.h"
 #include "Property.h"
 #include "PropertyContainer.h"
 
@@ -367,8 +369,11 @@ void PropertyContainer::Restore(Base::XMLReader &reader)
                         && !status.test(Property::PropTransient)
                         && !prop->testStatus(Property::PropTransient))
                 {
-                    FC_TRACE("restore property '" << prop->getName() << "'");
-                    prop->Restore(reader);
+                    auto parallelRestore = ParallelRestore::active();
+                    if (!parallelRestore || !parallelRestore->defer(prop, reader)) {
+                        FC_TRACE("restore property '" << prop->getName() << "'");
+                        prop->Restore(reader);
+                    }
                 }else
                     FC_TRACE("skip transient '" << prop->getName() << "'");
             }
@@ -448,6 +453,55 @@ struct PropertyData::Impl
     >
     > propertyData;
      // clang-format on
+
+    /**
+     * @brief A flat open addressing table on property name.
+     *
+     * The table is built once the property data is merged with its parents,
+     * after which no more properties are added.  Each slot keeps the hash of
+     * the name, so that a lookup only compares the strings of a match.
+     */
+    struct Slot
+    {
+        std::size_t hash = 0;
+        const PropertySpec* spec = nullptr;
+    };
+    std::vector<Slot> slots;
+
+    void buildIndex()
+    {
+        std::size_t size = 8;
+        while (size < propertyData.size() * 2) {
+            size *= 2;
+        }
+        slots.assign(size, Slot());
+        for (const auto& spec : propertyData.get<0>()) {
+            std::size_t hash = CStringHasher()(spec.Name);
+            std::size_t i = hash & (size - 1);
+            while (slots[i].spec) {
+                i = (i + 1) & (size - 1);
+            }
+            slots[i].hash = hash;
+            slots[i].spec = &spec;
+        }
+    }
+
+    const PropertySpec* find(const char* name) const
+    {
+        if (!name || slots.empty()) {
+            return nullptr;
+        }
+        std::size_t hash = CStringHasher()(name);
+        std::size_t mask = slots.size() - 1;
+        for (std::size_t i = hash & mask; slots[i].spec; i = (i + 1) & mask) {
+            const auto& slot = slots[i];
+            if (slot.spec->Name == name
+                || (slot.hash == hash && std::strcmp(slot.spec->Name, name) == 0)) {
+                return slot.spec;
+            }
+        }
+        return nullptr;
+    }
 };
 
 PropertyData::PropertyData(): impl(std::make_unique<Impl>()) {};
@@ -495,6 +549,7 @@ void PropertyData::merge(PropertyData *other) const {
         for(const auto &spec : other->impl->propertyData.get<0>())
             index.push_back(spec);
     }
+    impl->buildIndex();
 }
 
 void PropertyData::split(PropertyData *other) {
@@ -508,17 +563,14 @@ void PropertyData::split(PropertyData *other) {
         for(const auto &spec : other->impl->propertyData.get<0>())
             index.erase(spec.Offset);
     }
+    impl->buildIndex();
 }
 
 const PropertyData::PropertySpec *PropertyData::findProperty(OffsetBase offsetBase,const char* PropName) const
 {
     (void)offsetBase;
     merge();
-    auto &index = impl->propertyData.get<1>();
-    auto it = index.find(PropName);
-    if(it != index.end())
-        return &(*it);
-    return nullptr;
+    return impl->find(PropName);
 }
 
 const PropertyData::PropertySpec *PropertyData::findProperty(OffsetBase offsetBase,const Property* prop) const
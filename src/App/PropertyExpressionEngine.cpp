@@ -37,6 +37,7 @@
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "CompiledExpression.h"
 #include "ExpressionVisitors.h"
 
 
@@ -123,6 +124,14 @@ protected:
 };
 
 using DiGraph = boost::adjacency_list<boost::listS, boost::vecS, boost::directedS>;
+
+// The name generation of the owner document, 0 if there is none
+static unsigned long getNameGeneration(const PropertyContainer* container)
+{
+    auto owner = freecad_cast<const DocumentObject*>(container);
+    return CompiledExpression::getGeneration(owner ? owner->getDocument() : nullptr);
+}
+
 struct PropertyExpressionEngine::Private
 {
     // For some reason, MSVC has trouble with vector of scoped_connection if
@@ -130,6 +139,41 @@ struct PropertyExpressionEngine::Private
     std::vector<fastsignals::scoped_connection> conns;
     std::unordered_map<std::string, std::vector<ObjectIdentifier>> propMap;
 
+    // Dependency graph for incremental evaluation, see updateInputGraph()
+    struct Binding
+    {
+        ObjectIdentifier path;
+        bool dirty = true;
+        // Set if the inputs cannot be tracked, e.g. for pseudo properties
+        bool always = false;
+    };
+    // Bindings in evaluation order
+    std::vector<Binding> bindings;
+    // Bindings to mark dirty on change of a property or of any property of an object
+    std::unordered_map<const Property*, std::vector<std::size_t>> propInputs;
+    std::unordered_map<const DocumentObject*, std::vector<std::size_t>> objectInputs;
+    std::vector<fastsignals::scoped_connection> inputConns;
+    // Generation of the graph, 0 if invalid
+    unsigned long generation = 0;
+
+    static bool isExecuted(const Property* prop, ExecuteOption option)
+    {
+        if (option == ExecuteAll) {
+            return true;
+        }
+        bool is_output =
+            prop->testStatus(App::Property::Output) || (prop->getType() & App::Prop_Output);
+        if ((is_output && option == ExecuteNonOutput) || (!is_output && option == ExecuteOutput)) {
+            return false;
+        }
+        if (option == ExecuteOnRestore && !prop->testStatus(Property::Transient)
+            && !(prop->getType() & Prop_Transient)
+            && !prop->testStatus(Property::EvalOnRestore)) {
+            return false;
+        }
+        return true;
+    }
+
     /**
      * @brief Build a graph of all expressions in \a exprs.
      * @param exprs Expressions to use in graph
@@ -152,15 +196,7 @@ struct PropertyExpressionEngine::Private
                 if (!prop) {
                     throw Base::RuntimeError("Path does not resolve to a property.");
                 }
-                bool is_output =
-                    prop->testStatus(App::Property::Output) || (prop->getType() & App::Prop_Output);
-                if ((is_output && option == ExecuteNonOutput)
-                    || (!is_output && option == ExecuteOutput)) {
-                    continue;
-                }
-                if (option == ExecuteOnRestore && !prop->testStatus(Property::Transient)
-                    && !(prop->getType() & Prop_Transient)
-                    && !prop->testStatus(Property::EvalOnRestore)) {
+                if (!isExecuted(prop, option)) {
                     continue;
                 }
             }
@@ -266,6 +302,14 @@ Property* PropertyExpressionEngine::Copy() const
 
 void PropertyExpressionEngine::hasSetValue()
 {
+    for (auto& e : expressions) {
+        e.second.compiled.reset();
+        e.second.compiledGeneration = 0;
+    }
+    if (pimpl) {
+        pimpl->generation = 0;
+    }
+
     auto* owner = freecad_cast<App::DocumentObject*>(getContainer());
     if (!owner || !owner->isAttachedToDocument() || owner->isRestoring()
         || testFlag(LinkDetached)) {
@@ -360,6 +404,7 @@ void PropertyExpressionEngine::updateHiddenReference(const std::string& key)
     if (it == pimpl->propMap.end()) {
         return;
     }
+    bool compile = GetApplication().isCompiledExpressionEnabled();
     for (auto& var : it->second) {
         auto it = expressions.find(var);
         if (it == expressions.end() || it->second.busy) {
@@ -372,7 +417,7 @@ void PropertyExpressionEngine::updateHiddenReference(const std::string& key)
         Base::StateLocker guard(it->second.busy);
         App::any value;
         try {
-            value = it->second.expression->getValueAsAny();
+            value = evaluate(it->second, compile);
             if (!isAnyEqual(value, myProp->getPathValue(var))) {
                 myProp->setPathValue(var, value);
             }
@@ -406,6 +451,107 @@ void PropertyExpressionEngine::slotChangedProperty(const App::DocumentObject&,
     updateHiddenReference(prop.getFullName());
 }
 
+void PropertyExpressionEngine::slotChangedInput(const App::DocumentObject& obj,
+                                                const App::Property& prop)
+{
+    if (!pimpl || !pimpl->generation) {
+        return;
+    }
+    auto it = pimpl->propInputs.find(&prop);
+    if (it != pimpl->propInputs.end()) {
+        for (auto i : it->second) {
+            pimpl->bindings[i].dirty = true;
+        }
+    }
+    auto iter = pimpl->objectInputs.find(&obj);
+    if (iter != pimpl->objectInputs.end()) {
+        for (auto i : iter->second) {
+            pimpl->bindings[i].dirty = true;
+        }
+    }
+}
+
+void PropertyExpressionEngine::updateInputGraph()
+{
+    unsigned long generation = getNameGeneration(getContainer());
+    if (pimpl && generation && pimpl->generation == generation) {
+        return;
+    }
+    if (!pimpl) {
+        pimpl = std::make_unique<Private>();
+    }
+    pimpl->generation = 0;
+    pimpl->bindings.clear();
+    pimpl->propInputs.clear();
+    pimpl->objectInputs.clear();
+    pimpl->inputConns.clear();
+
+    for (auto& path : computeEvaluationOrder(ExecuteAll)) {
+        pimpl->bindings.emplace_back();
+        pimpl->bindings.back().path = path;
+    }
+
+    auto owner = freecad_cast<DocumentObject*>(getContainer());
+    const Document* document = owner ? owner->getDocument() : nullptr;
+
+    std::set<DocumentObject*> tracked;
+    auto track = [&](DocumentObject* obj) {
+        if (tracked.insert(obj).second) {
+            // NOLINTBEGIN
+            pimpl->inputConns.emplace_back(obj->signalChanged.connect(
+                std::bind(&PropertyExpressionEngine::slotChangedInput, this, sp::_1, sp::_2)));
+            // NOLINTEND
+        }
+    };
+
+    for (std::size_t i = 0; i < pimpl->bindings.size(); ++i) {
+        auto& binding = pimpl->bindings[i];
+        auto it = expressions.find(binding.path);
+        Property* prop = binding.path.getProperty();
+        if (it == expressions.end() || !it->second.expression || !prop) {
+            binding.always = true;
+            continue;
+        }
+
+        // Evaluate again if the bound property is changed by someone else
+        auto parent = freecad_cast<DocumentObject*>(prop->getContainer());
+        if (parent) {
+            track(parent);
+        }
+        pimpl->propInputs[prop].push_back(i);
+
+        for (auto& v : it->second.expression->getIdentifiers()) {
+            const ObjectIdentifier& var = v.first;
+            int ptype = 0;
+            if (!var.getProperty(&ptype) || ptype || !var.getSubObjectName().empty()) {
+                binding.always = true;
+                break;
+            }
+            for (auto& dep : var.getDep(true)) {
+                auto obj = dep.first;
+                if (obj->getDocument() != document) {
+                    // Renames in other documents do not advance the generation
+                    binding.always = true;
+                }
+                track(obj);
+                for (auto& propName : dep.second) {
+                    auto depProp = obj->getPropertyByName(propName.c_str());
+                    if (depProp) {
+                        pimpl->propInputs[depProp].push_back(i);
+                    }
+                    else {
+                        pimpl->objectInputs[obj].push_back(i);
+                    }
+                }
+                if (dep.second.empty()) {
+                    pimpl->objectInputs[obj].push_back(i);
+                }
+            }
+        }
+    }
+    pimpl->generation = generation;
+}
+
 void PropertyExpressionEngine::Paste(const Property& from)
 {
     const PropertyExpressionEngine& fromee = dynamic_cast<const PropertyExpressionEngine&>(from);
@@ -645,6 +791,23 @@ PropertyExpressionEngine::computeEvaluationOrder(ExecuteOption option)
     return evaluationOrder;
 }
 
+App::any PropertyExpressionEngine::evaluate(const ExpressionInfo& info, bool compile) const
+{
+    std::shared_ptr<App::Expression> expression = info.expression;
+    if (compile) {
+        unsigned long generation = getNameGeneration(getContainer());
+        if (info.compiledGeneration != generation) {
+            info.compiled = CompiledExpression::compile(expression.get());
+            info.compiledGeneration = generation;
+        }
+        App::any value;
+        if (info.compiled && info.compiled->eval(value)) {
+            return value;
+        }
+    }
+    return expression->getValueAsAny();
+}
+
 DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption option,
                                                                  bool* touched)
 {
@@ -700,9 +863,29 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
 
     resetter r(running);
 
-    // Compute evaluation order
-    std::vector<App::ObjectIdentifier> evaluationOrder = computeEvaluationOrder(option);
+    // Compute evaluation order.  In incremental mode, the order of all
+    // bindings is kept in the dependency graph, and filtered by option here.
+    std::vector<App::ObjectIdentifier> evaluationOrder;
+    std::vector<Private::Binding*> bindings;
+    bool incremental = GetApplication().isIncrementalExpressionEnabled();
+    if (incremental) {
+        updateInputGraph();
+        for (auto& binding : pimpl->bindings) {
+            Property* prop = binding.path.getProperty();
+            if (!prop) {
+                throw Base::RuntimeError("Path does not resolve to a property.");
+            }
+            if (Private::isExecuted(prop, option)) {
+                evaluationOrder.push_back(binding.path);
+                bindings.push_back(&binding);
+            }
+        }
+    }
+    else {
+        evaluationOrder = computeEvaluationOrder(option);
+    }
     std::vector<ObjectIdentifier>::const_iterator it = evaluationOrder.begin();
+    bool compile = GetApplication().isCompiledExpressionEnabled();
 
 #ifdef FC_PROPERTYEXPRESSIONENGINE_LOG
     std::clog << "Computing expressions for " << getName() << std::endl;
@@ -710,6 +893,12 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
 
     /* Evaluate the expressions, and update properties */
     for (; it != evaluationOrder.end(); ++it) {
+        Private::Binding* binding =
+            incremental ? bindings[it - evaluationOrder.begin()] : nullptr;
+        if (binding && !binding->dirty && !binding->always) {
+            ++skippedCount;
+            continue;
+        }
 
         // Get property to update
         Property* prop = it->getProperty();
@@ -729,9 +918,10 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
-            if (expression) {
-                value = expression->getValueAsAny();
+            const ExpressionInfo& info = expressions[*it];
+            if (info.expression) {
+                value = evaluate(info, compile);
+                ++evaluatedCount;
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -747,6 +937,9 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 // if (option == ExecuteOnRestore && prop->testStatus(Property::EvalOnRestore))
                 {
                     if (isAnyEqual(value, prop->getPathValue(*it))) {
+                        if (binding) {
+                            binding->dirty = false;
+                        }
                         continue;
                     }
                     if (touched) {
@@ -755,6 +948,10 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
                 }
                 prop->setPathValue(*it, value);
             }
+            // Cleared after setting the value, which marks the binding itself dirty
+            if (binding) {
+                binding->dirty = false;
+            }
         }
         catch (Base::Exception& e) {
             std::ostringstream ss;
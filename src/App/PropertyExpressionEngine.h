@@ -47,6 +47,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class CompiledExpression;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer: public App::PropertyXLinkContainer
@@ -151,6 +152,10 @@ public:
     {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
         bool busy;
+        /// The compiled form of the expression, if it could be compiled.
+        mutable std::shared_ptr<App::CompiledExpression> compiled;
+        /// The generation of the last compile attempt, 0 if never compiled.
+        mutable unsigned long compiledGeneration = 0;
 
         explicit ExpressionInfo(
             std::shared_ptr<App::Expression> expression = std::shared_ptr<App::Expression>())
@@ -307,6 +312,32 @@ public:
     /// Get the number of expressions managed by this object.
     size_t numExpressions() const;
 
+    /// The number of expression bindings evaluated by execute().
+    std::size_t getEvaluatedCount() const
+    {
+        return evaluatedCount;
+    }
+
+    /**
+     * @brief The number of expression bindings skipped by execute().
+     *
+     * With incremental evaluation enabled, see
+     * Application::isIncrementalExpressionEnabled(), a binding is only
+     * evaluated if any of its inputs or its bound property changed since its
+     * last evaluation.
+     */
+    std::size_t getSkippedCount() const
+    {
+        return skippedCount;
+    }
+
+    /// Reset the evaluated and skipped counters.
+    void resetCounters()
+    {
+        evaluatedCount = 0;
+        skippedCount = 0;
+    }
+
     /// signal called when an expression was changed
     fastsignals::signal<void(const App::ObjectIdentifier&)> expressionChanged;
 
@@ -352,11 +383,38 @@ private:
 
     void slotChangedObject(const App::DocumentObject& obj, const App::Property& prop);
     void slotChangedProperty(const App::DocumentObject& obj, const App::Property& prop);
+    void slotChangedInput(const App::DocumentObject& obj, const App::Property& prop);
     void updateHiddenReference(const std::string& key);
 
+    /**
+     * @brief Update the dependency graph used for incremental evaluation.
+     *
+     * The graph is kept until the expressions change or an object identifier
+     * may resolve differently, see Document::getNameGeneration().  Bindings
+     * depending on other documents are always evaluated.  All expression
+     * bindings are marked for evaluation after a rebuild.
+     *
+     * @throws Base::RuntimeError if a circular dependency is detected.
+     */
+    void updateInputGraph();
+
+    /**
+     * @brief Evaluate an expression binding.
+     *
+     * @param[in] info The expression binding.
+     * @param[in] compile If true, use the compiled form of the expression
+     * when possible, see CompiledExpression.
+     *
+     * @return The value of the expression.
+     */
+    boost::any evaluate(const ExpressionInfo& info, bool compile) const;
+
     bool running = false; /**< Boolean used to avoid loops */
     bool restoring = false;
 
+    std::size_t evaluatedCount = 0;
+    std::size_t skippedCount = 0;
+
     ExpressionMap expressions; /**< Stored expressions */
 
     ValidatorFunc validator; /**< Valdiator functor */
@@ -377,12 +377,12 @@ Property* PropertyVectorList::Copy() const
 
 void PropertyVectorList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyVectorList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyVectorList&>(from));
 }
 
 unsigned int PropertyVectorList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
+    return getSharedMemSize(_lValueList.size() * sizeof(Base::Vector3d));
 }
 
 //**************************************************************************
@@ -1019,12 +1019,12 @@ Property* PropertyPlacementList::Copy() const
 
 void PropertyPlacementList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyPlacementList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyPlacementList&>(from));
 }
 
 unsigned int PropertyPlacementList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3d));
+    return getSharedMemSize(_lValueList.size() * sizeof(Base::Vector3d));
 }
 
 
@@ -1292,7 +1292,10 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::PropertyComplexGeoData, App::PropertyGeometry)
 
 PropertyComplexGeoData::PropertyComplexGeoData() = default;
 
-PropertyComplexGeoData::~PropertyComplexGeoData() = default;
+PropertyComplexGeoData::~PropertyComplexGeoData()
+{
+    resetLazyFile();
+}
 
 std::string PropertyComplexGeoData::getElementMapVersion(bool) const
 {
@@ -1313,8 +1316,56 @@ bool PropertyComplexGeoData::checkElementMapVersion(const char* ver) const
 }
 
 
+bool PropertyComplexGeoData::setLazyFile(
+    const std::shared_ptr<Base::LazyDocFile>& file,
+    std::function<void(Base::Reader&)> loader
+)
+{
+    resetLazyFile();
+    if (!file->addLoader(this, std::move(loader))) {
+        return false;
+    }
+    lazyFile = file;
+    return true;
+}
+
+void PropertyComplexGeoData::loadLazyFile() const
+{
+    if (lazyFile && !lazyLoadBlocked) {
+        lazyFile->load();
+    }
+}
+
+void PropertyComplexGeoData::resetLazyFile()
+{
+    if (lazyFile) {
+        lazyFile->removeLoader(this);
+        lazyFile.reset();
+    }
+}
+
+bool PropertyComplexGeoData::copyLazyFile(PropertyComplexGeoData& copy) const
+{
+    return lazyFile && copy.restoreDocFileLazily(lazyFile);
+}
+
+bool PropertyComplexGeoData::hasPendingLazyFile() const
+{
+    return lazyFile && !lazyFile->isLoaded();
+}
+
+std::size_t PropertyComplexGeoData::getLazyFileSize() const
+{
+    if (!hasPendingLazyFile()) {
+        return 0;
+    }
+    return lazyFile->getSize();
+}
+
 void PropertyComplexGeoData::afterRestore()
 {
+    // The restore state of the element map is known without the postponed data
+    Base::StateLocker guard(lazyLoadBlocked);
     auto data = getComplexData();
     if (data && data->isRestoreFailed()) {
         data->resetRestoreFailure();
@@ -25,6 +25,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <Base/BoundBox.h>
 #include <Base/Matrix.h>
 #include <Base/Placement.h>
@@ -37,6 +40,8 @@
 
 namespace Base
 {
+class LazyDocFile;
+class Reader;
 class Writer;
 }
 
@@ -575,6 +580,40 @@ public:
     virtual bool checkElementMapVersion(const char* ver) const;
 
     void afterRestore() override;
+
+    /** Return true if the data file has been postponed and not read yet
+     * getComplexData() reads it, getMemSize() includes its size without
+     * reading it.
+     */
+    bool hasPendingLazyFile() const;
+
+protected:
+    /** Postpone restoring the data file until loadLazyFile()
+     * Subclasses call this from restoreDocFileLazily(). The loader must read
+     * the data without notifying the container, because it may run at any
+     * later time, e.g. in the middle of a recompute or on a worker thread.
+     * Returns false if the file has already been loaded.
+     */
+    bool setLazyFile(
+        const std::shared_ptr<Base::LazyDocFile>& file,
+        std::function<void(Base::Reader&)> loader
+    );
+    /// Restore the postponed data, must be called before accessing it
+    void loadLazyFile() const;
+    /// Forget the postponed data, e.g. because it got restored regularly
+    void resetLazyFile();
+    /** Let a copy of this property share the postponed data
+     * Used by Copy() so that e.g. the undo copy taken right before a new
+     * value is set does not read the old data. Returns false if there is no
+     * postponed data, the copy must then take the current value.
+     */
+    bool copyLazyFile(PropertyComplexGeoData& copy) const;
+    /// Return the size of the postponed data that has not been read yet
+    std::size_t getLazyFileSize() const;
+
+private:
+    std::shared_ptr<Base::LazyDocFile> lazyFile;
+    mutable bool lazyLoadBlocked {false};
 };
 
 }  // namespace App
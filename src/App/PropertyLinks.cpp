@@ -1189,7 +1189,7 @@ void PropertyLinkList::Paste(const Property& from)
 
 unsigned int PropertyLinkList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(App::DocumentObject*));
+    return getSharedMemSize(_lValueList.size() * sizeof(App::DocumentObject*));
 }
 
 
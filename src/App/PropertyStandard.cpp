@@ -151,6 +151,9 @@ void PropertyInteger::setPathValue(const ObjectIdentifier& path, const boost::an
     else if (value.type() == typeid(int)) {
         setValue(boost::any_cast<int>(value));
     }
+    else if (value.type() == typeid(bool)) {
+        setValue(boost::any_cast<bool>(value) ? 1 : 0);
+    }
     else if (value.type() == typeid(double)) {
         setValue(boost::math::round(boost::any_cast<double>(value)));
     }
@@ -916,12 +919,12 @@ Property* PropertyIntegerList::Copy() const
 
 void PropertyIntegerList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyIntegerList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyIntegerList&>(from));
 }
 
 unsigned int PropertyIntegerList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(long));
+    return getSharedMemSize(_lValueList.size() * sizeof(long));
 }
 
 
@@ -1145,6 +1148,9 @@ void PropertyFloat::setPathValue(const ObjectIdentifier& path, const boost::any&
     else if (value.type() == typeid(int)) {
         setValue(boost::any_cast<int>(value));
     }
+    else if (value.type() == typeid(bool)) {
+        setValue(boost::any_cast<bool>(value) ? 1.0 : 0.0);
+    }
     else if (value.type() == typeid(double)) {
         setValue(boost::any_cast<double>(value));
     }
@@ -1508,12 +1514,12 @@ Property* PropertyFloatList::Copy() const
 
 void PropertyFloatList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyFloatList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyFloatList&>(from));
 }
 
 unsigned int PropertyFloatList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(double));
+    return getSharedMemSize(_lValueList.size() * sizeof(double));
 }
 
 //**************************************************************************
@@ -1884,7 +1890,7 @@ unsigned int PropertyStringList::getMemSize() const
     for (int i = 0; i < getSize(); i++) {
         size += _lValueList[i].size();
     }
-    return static_cast<unsigned int>(size);
+    return getSharedMemSize(size);
 }
 
 void PropertyStringList::Save(Base::Writer& writer) const
@@ -1927,7 +1933,7 @@ Property* PropertyStringList::Copy() const
 
 void PropertyStringList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyStringList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyStringList&>(from));
 }
 
 
@@ -2727,12 +2733,12 @@ Property* PropertyColorList::Copy() const
 
 void PropertyColorList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyColorList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyColorList&>(from));
 }
 
 unsigned int PropertyColorList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Color));
+    return getSharedMemSize(_lValueList.size() * sizeof(Base::Color));
 }
 
 //**************************************************************************
@@ -3654,7 +3660,7 @@ void PropertyMaterialList::Paste(const Property& from)
 
 unsigned int PropertyMaterialList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Material));
+    return getSharedMemSize(_lValueList.size() * sizeof(Material));
 }
 
 //**************************************************************************
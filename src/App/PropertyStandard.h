@@ -392,6 +392,10 @@ public:
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
+    bool canRestoreConcurrently() const override
+    {
+        return true;
+    }
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
@@ -528,6 +532,10 @@ public:
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
+    bool canRestoreConcurrently() const override
+    {
+        return true;
+    }
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
@@ -923,6 +931,10 @@ public:
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
+    bool canRestoreConcurrently() const override
+    {
+        return true;
+    }
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
@@ -1008,6 +1020,10 @@ public:
 
     void Save(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
+    bool canRestoreConcurrently() const override
+    {
+        return true;
+    }
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
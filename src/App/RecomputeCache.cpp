@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include <QCryptographicHash>
+
+#include <Base/Console.h>
+#include <Base/Writer.h>
+
+#include "RecomputeCache.h"
+#include "DocumentObject.h"
+#include "PropertyLinks.h"
+
+
+FC_LOG_LEVEL_INIT("App", true, true)
+
+using namespace App;
+
+namespace
+{
+
+void addData(QCryptographicHash& hash, const std::string& data)
+{
+#if QT_VERSION < QT_VERSION_CHECK(6, 3, 0)
+    hash.addData(data.c_str(), static_cast<int>(data.size()));
+#else
+    hash.addData(QByteArrayView(data.c_str(), static_cast<qsizetype>(data.size())));
+#endif
+}
+
+bool isOutputProperty(const Property* prop)
+{
+    return ((prop->getType() & Prop_Output) != 0) || prop->testStatus(Property::Output);
+}
+
+}  // namespace
+
+RecomputeCache::RecomputeCache(std::size_t maxEntriesPerObject)
+    : maxEntries(std::max<std::size_t>(1, maxEntriesPerObject))
+{}
+
+RecomputeCache::~RecomputeCache() = default;
+
+std::string RecomputeCache::computeKey(const DocumentObject* obj,
+                                       const std::set<std::string>& outputs)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    addData(hash, obj->getTypeId().getName());
+
+    std::vector<std::pair<const char*, Property*>> props;
+    obj->getPropertyNamedList(props);
+    for (const auto& [name, prop] : props) {
+        if (isOutputProperty(prop) || outputs.contains(name)) {
+            continue;
+        }
+        Base::StringWriter writer;
+        prop->Save(writer);
+        addData(hash, name);
+        addData(hash, writer.getString());
+        // File backed properties only save the file name to the XML
+        for (const auto& [file, persistence] : writer.getFiles()) {
+            Base::StringWriter content;
+            persistence->SaveDocFile(content);
+            addData(hash, content.getString());
+        }
+    }
+
+    auto outList = obj->getOutList();
+    std::sort(outList.begin(), outList.end());
+    outList.erase(std::unique(outList.begin(), outList.end()), outList.end());
+
+    for (auto dep : outList) {
+        addData(hash, dep->getFullName());
+        addData(hash, std::to_string(dep->getChangeSerial()));
+    }
+    return hash.result().toHex().toStdString();
+}
+
+bool RecomputeCache::restore(DocumentObject* obj)
+{
+    std::set<std::string> outputs;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(obj);
+        if (it == entries.end()) {
+            ++misses;
+            return false;
+        }
+        outputs = it->second.outputs;
+    }
+
+    std::string key = computeKey(obj, outputs);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto& results = entries[obj].results;
+    auto it = std::find_if(results.begin(), results.end(), [&key](const auto& result) {
+        return result.key == key;
+    });
+    if (it == results.end()) {
+        ++misses;
+        return false;
+    }
+    // move to front to keep the most recently used results
+    results.splice(results.begin(), results, it);
+    ++hits;
+    lock.unlock();
+
+    FC_LOG("Restore cached result of " << obj->getFullName());
+    // The result stays owned by the cache, so the pasting must not happen
+    // while another thread may evict it. Eviction only happens on store()
+    // of the same object, which cannot run concurrently with this call.
+    const auto& result = results.front();
+    for (const auto& [name, copy] : result.values) {
+        auto prop = obj->getPropertyByName(name.c_str());
+        if (prop && prop->getTypeId() == copy->getTypeId()) {
+            prop->Paste(*copy);
+        }
+    }
+    // The object is in the state of the cached execution again
+    obj->_changeSerial = result.serial;
+    return true;
+}
+
+void RecomputeCache::store(DocumentObject* obj, const std::set<std::string>& changed)
+{
+    Result result {{}, obj->getChangeSerial(), {}};
+    for (const auto& name : changed) {
+        auto prop = obj->getPropertyByName(name.c_str());
+        if (!prop) {
+            continue;
+        }
+        if (prop->isDerivedFrom<PropertyLinkBase>()) {
+            // Restoring links would change the dependency graph during
+            // recompute, so do not cache such objects.
+            return;
+        }
+        result.values.emplace_back(name, std::unique_ptr<Property>(prop->Copy()));
+    }
+
+    std::set<std::string> outputs;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = entries[obj];
+        entry.outputs.insert(changed.begin(), changed.end());
+        outputs = entry.outputs;
+    }
+
+    result.key = computeKey(obj, outputs);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& results = entries[obj].results;
+    std::erase_if(results, [&result](const auto& entry) {
+        return entry.key == result.key;
+    });
+    results.push_front(std::move(result));
+    if (results.size() > maxEntries) {
+        results.resize(maxEntries);
+    }
+}
+
+void RecomputeCache::remove(const DocumentObject* obj)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(obj);
+}
+
+void RecomputeCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+std::size_t RecomputeCache::getHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+std::size_t RecomputeCache::getMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+std::size_t RecomputeCache::getEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t count = 0;
+    for (const auto& [obj, entry] : entries) {
+        count += entry.results.size();
+    }
+    return count;
+}
+
+std::size_t RecomputeCache::getMemSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t size = 0;
+    for (const auto& [obj, entry] : entries) {
+        for (const auto& result : entry.results) {
+            size += result.key.size();
+            for (const auto& [name, prop] : result.values) {
+                size += name.size() + prop->getMemSize();
+            }
+        }
+    }
+    return size;
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+class Property;
+
+/**
+ * @brief A content addressed cache of recompute results.
+ *
+ * The cache maps a digest of the input of a document object to a copy of the
+ * properties its last execution with that input produced. The input digest
+ * covers the object's own non-output properties, including the content of
+ * the data files they save, and the DocumentObject::getChangeSerial() of each
+ * object it depends on, in any document. Restoring a result also restores the
+ * change serial the object had after the cached execution, so a hit upstream
+ * keeps the results of the objects depending on it valid.
+ *
+ * The output properties are learned while the object executes, i.e. any
+ * property changed by DocumentObject::recompute() is considered an output and
+ * is excluded from the input digest.
+ *
+ * Only objects that return true from DocumentObject::canCacheRecompute() are
+ * cached. It is safe to use the cache from several threads.
+ */
+class AppExport RecomputeCache
+{
+public:
+    /**
+     * @brief Construct a recompute cache.
+     *
+     * @param[in] maxEntriesPerObject The number of results kept per object.
+     */
+    explicit RecomputeCache(std::size_t maxEntriesPerObject = 4);
+    ~RecomputeCache();
+
+    RecomputeCache(const RecomputeCache&) = delete;
+    RecomputeCache(RecomputeCache&&) = delete;
+    RecomputeCache& operator=(const RecomputeCache&) = delete;
+    RecomputeCache& operator=(RecomputeCache&&) = delete;
+
+    /**
+     * @brief Restore the cached result of an object.
+     *
+     * @param[in] obj The object to restore.
+     * @return True if a result for the current input was found and restored.
+     */
+    bool restore(DocumentObject* obj);
+
+    /**
+     * @brief Store the result of a successful execution of an object.
+     *
+     * @param[in] obj The executed object.
+     * @param[in] changed The names of the properties changed by the execution.
+     */
+    void store(DocumentObject* obj, const std::set<std::string>& changed);
+
+    /// Remove all cached results of an object.
+    void remove(const DocumentObject* obj);
+    /// Remove all cached results.
+    void clear();
+
+    /// The number of restored results.
+    std::size_t getHits() const;
+    /// The number of cache lookups without a result.
+    std::size_t getMisses() const;
+    /// The number of cached results.
+    std::size_t getEntryCount() const;
+    /// The approximate memory used by the cached results in bytes.
+    std::size_t getMemSize() const;
+
+private:
+    struct Result
+    {
+        std::string key;
+        // the change serial of the object after the execution
+        std::uint64_t serial;
+        std::vector<std::pair<std::string, std::unique_ptr<Property>>> values;
+    };
+
+    struct ObjectEntry
+    {
+        std::set<std::string> outputs;
+        std::list<Result> results;
+    };
+
+    std::string computeKey(const DocumentObject* obj, const std::set<std::string>& outputs);
+
+    mutable std::mutex mutex;
+    std::unordered_map<const DocumentObject*, ObjectEntry> entries;
+    std::size_t maxEntries;
+    std::size_t hits {0};
+    std::size_t misses {0};
+};
+
+}  // namespace App
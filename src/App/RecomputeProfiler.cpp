@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#include <algorithm>
+
+#include <nlohmann/json.hpp>
+
+#include "RecomputeProfiler.h"
+#include "DocumentObject.h"
+
+
+using namespace App;
+
+namespace
+{
+
+double toSeconds(RecomputeProfiler::Clock::duration time)
+{
+    return std::chrono::duration<double>(time).count();
+}
+
+}  // namespace
+
+RecomputeProfiler::RecomputeProfiler(std::size_t maxProfiles)
+    : maxProfiles(std::max<std::size_t>(1, maxProfiles))
+{}
+
+bool RecomputeProfiler::begin()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return false;
+    }
+    running = true;
+    start = Clock::now();
+    current = Profile();
+    current.start = std::chrono::system_clock::now();
+    indices.clear();
+    return true;
+}
+
+void RecomputeProfiler::end()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!running) {
+        return;
+    }
+    running = false;
+    current.time = toSeconds(Clock::now() - start);
+    history.push_back(std::move(current));
+    current = Profile();
+    indices.clear();
+    while (history.size() > maxProfiles) {
+        history.pop_front();
+    }
+}
+
+void RecomputeProfiler::record(const DocumentObject* obj, Clock::duration time)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!running || !obj) {
+        return;
+    }
+    auto res = indices.emplace(obj, current.objects.size());
+    if (res.second) {
+        ObjectProfile profile;
+        if (const char* name = obj->getNameInDocument()) {
+            profile.name = name;
+        }
+        profile.label = obj->Label.getStrValue();
+        profile.type = obj->getTypeId().getName();
+        current.objects.push_back(std::move(profile));
+    }
+    auto& profile = current.objects[res.first->second];
+    profile.time += toSeconds(time);
+    ++profile.executions;
+}
+
+std::deque<RecomputeProfiler::Profile> RecomputeProfiler::getHistory() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return history;
+}
+
+void RecomputeProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    history.clear();
+}
+
+std::string RecomputeProfiler::toJson() const
+{
+    auto profiles = getHistory();
+    nlohmann::json res = nlohmann::json::array();
+    for (const auto& profile : profiles) {
+        nlohmann::json objects = nlohmann::json::array();
+        for (const auto& object : profile.objects) {
+            objects.push_back({{"Name", object.name},
+                               {"Label", object.label},
+                               {"Type", object.type},
+                               {"Time", object.time},
+                               {"Executions", object.executions}});
+        }
+        auto start = std::chrono::duration<double>(profile.start.time_since_epoch()).count();
+        res.push_back({{"Start", start}, {"Time", profile.time}, {"Objects", std::move(objects)}});
+    }
+    return res.dump(1);
+}
+
+RecomputeProfiler::Session::Session(RecomputeProfiler& profiler)
+    : profiler(profiler)
+    , started(profiler.begin())
+{}
+
+RecomputeProfiler::Session::~Session()
+{
+    if (started) {
+        profiler.end();
+    }
+}
+
+RecomputeProfiler::Scope::Scope(RecomputeProfiler& profiler, const DocumentObject* obj)
+    : profiler(profiler)
+    , obj(obj)
+    , start(Clock::now())
+{}
+
+RecomputeProfiler::Scope::~Scope()
+{
+    profiler.record(obj, Clock::now() - start);
+}
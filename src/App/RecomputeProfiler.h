@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <FCGlobal.h>
+
+namespace App
+{
+
+class DocumentObject;
+
+/**
+ * @brief Records the execution time of the objects of each recompute.
+ *
+ * A profile is started and finished by Document::recompute(), and every
+ * object executed in between is added to it with its wall time and the
+ * number of times it was executed. The last profiles are kept as a rolling
+ * history, which can be dumped as JSON to find the objects dominating the
+ * rebuild time of a document.
+ *
+ * Recording only reads the clock and takes a lock once per executed object,
+ * so the profiler is always active. It is safe to record from several
+ * threads.
+ */
+class AppExport RecomputeProfiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// The execution statistics of an object during a recompute.
+    struct ObjectProfile
+    {
+        std::string name;
+        std::string label;
+        std::string type;
+        double time {0.0};  /**< Wall time of all executions in seconds */
+        int executions {0};
+    };
+
+    /// A finished recompute.
+    struct Profile
+    {
+        std::chrono::system_clock::time_point start;
+        double time {0.0};  /**< Wall time of the whole recompute in seconds */
+        std::vector<ObjectProfile> objects;  /**< In the order of the first execution */
+    };
+
+    /**
+     * @brief Construct a recompute profiler.
+     *
+     * @param[in] maxProfiles The number of profiles kept in the history.
+     */
+    explicit RecomputeProfiler(std::size_t maxProfiles = 10);
+
+    /**
+     * @brief Start a new profile.
+     *
+     * @return False if a profile is already running.
+     */
+    bool begin();
+    /// Finish the running profile and add it to the history.
+    void end();
+
+    /**
+     * @brief Add an execution of an object to the running profile.
+     *
+     * @param[in] obj The executed object.
+     * @param[in] time The wall time of the execution.
+     */
+    void record(const DocumentObject* obj, Clock::duration time);
+
+    /// The finished profiles, the most recent last.
+    std::deque<Profile> getHistory() const;
+    /// Remove all finished profiles.
+    void clear();
+
+    /// Write the history as a JSON array.
+    std::string toJson() const;
+
+    /// Runs a profile for the lifetime of the session, unless one is already running.
+    class Session
+    {
+    public:
+        explicit Session(RecomputeProfiler& profiler);
+        ~Session();
+
+        Session(const Session&) = delete;
+        Session(Session&&) = delete;
+        Session& operator=(const Session&) = delete;
+        Session& operator=(Session&&) = delete;
+
+    private:
+        RecomputeProfiler& profiler;
+        bool started;
+    };
+
+    /// Records the execution of an object for the lifetime of the scope.
+    class Scope
+    {
+    public:
+        Scope(RecomputeProfiler& profiler, const DocumentObject* obj);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        RecomputeProfiler& profiler;
+        const DocumentObject* obj;
+        Clock::time_point start;
+    };
+
+private:
+    mutable std::mutex mutex;
+    std::deque<Profile> history;
+    std::size_t maxProfiles;
+    bool running {false};
+    Clock::time_point start;
+    Profile current;
+    std::unordered_map<const DocumentObject*, std::size_t> indices;
+};
+
+}  // namespace App
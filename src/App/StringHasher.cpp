@@ -23,7 +23,11 @@
 
 #include <QCryptographicHash>
 #include <QHash>
+#include <array>
 #include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_set>
 
 #include <Base/Console.h>
 #include <Base/Reader.h>
@@ -32,9 +36,6 @@
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
-#include <boost/bimap.hpp>
-#include <boost/bimap/set_of.hpp>
-#include <boost/bimap/unordered_set_of.hpp>
 #include <boost/io/ios_state.hpp>
 #include <boost/iostreams/stream.hpp>
 
@@ -73,15 +74,130 @@ struct StringIDHasher
     }
 };
 
-using HashMapBase =
-    boost::bimap<boost::bimaps::unordered_set_of<StringID*, StringIDHasher, StringIDHasher>,
-                 boost::bimaps::set_of<long>>;
-
-class StringHasher::HashMap: public HashMapBase
+/* The table of strings is split into shards by the hash of the string, each
+ * with its own lock, so that concurrent lookups rarely wait for each other.
+ * The map from ID to string has a separate lock, which is always taken after
+ * the lock of a shard.
+ */
+class StringHasher::HashMap
 {
 public:
     bool SaveAll = false;
     int Threshold = 0;
+
+    static constexpr std::size_t ShardCount = 16;
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::unordered_set<StringID*, StringIDHasher, StringIDHasher> strings;
+    };
+
+    std::array<Shard, ShardCount> shards;
+    std::mutex idMutex;
+    std::map<long, StringID*> ids;
+
+    /// Locks the whole table, for operations that iterate or remove entries.
+    class TableLock
+    {
+    public:
+        explicit TableLock(HashMap& map)
+            : map(map)
+        {
+            for (auto& shard : map.shards) {
+                shard.mutex.lock();
+            }
+            map.idMutex.lock();
+        }
+
+        ~TableLock()
+        {
+            map.idMutex.unlock();
+            for (auto& shard : map.shards) {
+                shard.mutex.unlock();
+            }
+        }
+
+        TableLock(const TableLock&) = delete;
+        TableLock(TableLock&&) = delete;
+        TableLock& operator=(const TableLock&) = delete;
+        TableLock& operator=(TableLock&&) = delete;
+
+    private:
+        HashMap& map;
+    };
+
+    Shard& getShard(const StringID* sid)
+    {
+        // The low bits are used by the buckets of the shard
+        return shards[(StringIDHasher()(sid) >> 8) % ShardCount];
+    }
+
+    StringIDRef find(const StringID* key)
+    {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.strings.find(const_cast<StringID*>(key));
+        if (it == shard.strings.end()) {
+            return {};
+        }
+        return {*it};
+    }
+
+    StringIDRef find(long id)
+    {
+        std::lock_guard<std::mutex> lock(idMutex);
+        auto it = ids.find(id);
+        if (it == ids.end()) {
+            return {};
+        }
+        return {it->second};
+    }
+
+    /// Insert a string, or return the existing entry with the same string or ID.
+    StringIDRef insert(StringHasher* hasher, StringID* sid, bool newID)
+    {
+        auto& shard = getShard(sid);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.strings.find(sid);
+        if (it != shard.strings.end()) {
+            return {*it};
+        }
+        {
+            std::lock_guard<std::mutex> idLock(idMutex);
+            if (newID) {
+                sid->_id = ids.empty() ? 1 : ids.rbegin()->first + 1;
+            }
+            auto res = ids.emplace(sid->_id, sid);
+            if (!res.second) {
+                return {res.first->second};
+            }
+        }
+        shard.strings.insert(sid);
+        sid->_hasher = hasher;
+        sid->ref();
+        return {sid};
+    }
+
+    void erase(StringID* sid)
+    {
+        auto& shard = getShard(sid);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        std::lock_guard<std::mutex> idLock(idMutex);
+        eraseLocked(sid);
+    }
+
+    /// Remove an entry while holding a TableLock.
+    bool eraseLocked(StringID* sid)
+    {
+        auto it = ids.find(sid->_id);
+        if (it == ids.end() || it->second != sid) {
+            return false;
+        }
+        ids.erase(it);
+        getShard(sid).strings.erase(sid);
+        return true;
+    }
 };
 
 ///////////////////////////////////////////////////////////
@@ -91,7 +207,7 @@ TYPESYSTEM_SOURCE_ABSTRACT(App::StringID, Base::BaseClass)
 StringID::~StringID()
 {
     if (_hasher) {
-        _hasher->_hashes->right.erase(_id);
+        _hasher->_hashes->erase(this);
     }
 }
 
@@ -195,10 +311,14 @@ void StringHasher::compact()
         return;
     }
 
+    // The reference counts are only meaningful while nobody can look up an
+    // entry, so they are checked and acted on under the table lock
+    HashMap::TableLock lock(*_hashes);
+
     // Make a list of all the table entries that have only a single reference and are not marked
     // "persistent"
     std::deque<StringIDRef> pendings;
-    for (auto& hasher : _hashes->right) {
+    for (auto& hasher : _hashes->ids) {
         if (!hasher.second->isPersistent() && hasher.second->getRefCount() == 1) {
             pendings.emplace_back(hasher.second);
         }
@@ -208,8 +328,14 @@ void StringHasher::compact()
     while (!pendings.empty()) {
         StringIDRef sid = pendings.front();
         pendings.pop_front();
+        // Check again, the entry may have been queued twice or be referenced
+        // by a StringID that is still alive. The references left are the
+        // table and this one.
+        if (sid._sid->getRefCount() != 2) {
+            continue;
+        }
         // Try to erase the map entry for this StringID
-        if (_hashes->right.erase(sid.value()) == 0U) {
+        if (!_hashes->eraseLocked(sid._sid)) {
             continue;  // If nothing was erased, there's nothing more to do
         }
         sid._sid->_hasher = nullptr;
@@ -243,12 +369,11 @@ int StringHasher::getThreshold() const
 
 long StringHasher::lastID() const
 {
-    if (_hashes->right.empty()) {
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
+    if (_hashes->ids.empty()) {
         return 0;
     }
-    auto it = _hashes->right.end();
-    --it;
-    return it->first;
+    return _hashes->ids.rbegin()->first;
 }
 
 StringIDRef StringHasher::getID(const char* text, int len, bool hashable)
@@ -277,9 +402,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
         dataID._data = data;
     }
 
-    auto it = _hashes->left.find(&dataID);
-    if (it != _hashes->left.end()) {
-        return {it->first};
+    if (auto res = _hashes->find(&dataID)) {
+        return res;
     }
 
     if (!hashed && !nocopy) {
@@ -294,8 +418,8 @@ StringIDRef StringHasher::getID(const QByteArray& data, Options options)
     if (hashed) {
         flags.setFlag(StringID::Flag::Hashed);
     }
-    StringIDRef sid(new StringID(lastID() + 1, dataID._data, flags));
-    return {insert(sid)};
+    StringIDRef sid(new StringID(0, dataID._data, flags));
+    return insert(sid, true);
 }
 
 StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<StringIDRef>& sids)
@@ -321,9 +445,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // Check to see if there is already an entry in the hash table for this StringID
-    auto it = _hashes->left.find(&tempID);
-    if (it != _hashes->left.end()) {
-        auto res = StringIDRef(it->first);
+    if (auto res = _hashes->find(&tempID)) {
         if (indexed) {
             res._index = indexed.getIndex();
         }
@@ -349,7 +471,7 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
     }
 
     // The real StringID object that we are going to insert
-    StringIDRef newStringIDRef(new StringID(lastID() + 1, tempID._data));
+    StringIDRef newStringIDRef(new StringID(0, tempID._data));
     StringID& newStringID = *newStringIDRef._sid;
     if (tempID._postfix.size() != 0) {
         newStringID._flags.setFlag(StringID::Flag::Postfixed);
@@ -429,7 +551,9 @@ StringIDRef StringHasher::getID(const Data::MappedName& name, const QVector<Stri
         }
     }
 
-    return {insert(newStringIDRef), indexed.getIndex()};
+    auto res = insert(newStringIDRef, true);
+    res._index = indexed.getIndex();
+    return res;
 }
 
 StringIDRef StringHasher::getID(long id, int index) const
@@ -437,12 +561,10 @@ StringIDRef StringHasher::getID(long id, int index) const
     if (id <= 0) {
         return {};
     }
-    auto it = _hashes->right.find(id);
-    if (it == _hashes->right.end()) {
-        return {};
+    StringIDRef res = _hashes->find(id);
+    if (res) {
+        res._index = index;
     }
-    StringIDRef res(it->second);
-    res._index = index;
     return res;
 }
 
@@ -462,7 +584,7 @@ const std::string& StringHasher::getPersistenceFileName() const
 void StringHasher::Save(Base::Writer& writer) const
 {
 
-    std::size_t count = _hashes->SaveAll ? _hashes->size() : this->count();
+    std::size_t count = _hashes->SaveAll ? this->size() : this->count();
 
     writer.Stream() << writer.ind() << "<StringHasher saveall=\"" << _hashes->SaveAll
                     << "\" threshold=\"" << _hashes->Threshold << "\"";
@@ -505,7 +627,8 @@ void StringHasher::saveStream(std::ostream& stream) const
     long lastID = 0;
     bool relative = false;
 
-    for (auto& hasher : _hashes->right) {
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
+    for (auto& hasher : _hashes->ids) {
         auto& d = *hasher.second;
         long id = d._id;
         if (!_hashes->SaveAll && !d.isMarked() && !d.isPersistent()) {
@@ -597,7 +720,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
     std::string ver;
     reader >> marker;
     std::size_t count = 0;
-    _hashes->clear();
+    clear();
     if (marker == "StringTableStart") {
         reader >> ver >> count;
         if (ver != "v1") {
@@ -613,7 +736,7 @@ void StringHasher::RestoreDocFile(Base::Reader& reader)
 void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
 {
     Base::TextInputStream asciiStream(stream);
-    _hashes->clear();
+    clear();
     std::string content;
     boost::io::ios_flags_saver ifs(stream);
     stream >> std::hex;
@@ -722,28 +845,19 @@ void StringHasher::restoreStreamNew(std::istream& stream, std::size_t count)
             }
         }
 
-        last = insert(sid);
+        last = insert(sid)._sid;
     }
 }
 
-StringID* StringHasher::insert(const StringIDRef& sid)
+StringIDRef StringHasher::insert(const StringIDRef& sid, bool newID)
 {
     assert(sid && sid._sid->_hasher == nullptr);
-    auto& hasher = *sid._sid;
-    hasher._hasher = this;
-    hasher.ref();
-    auto res = _hashes->right.insert(_hashes->right.end(),
-                                     HashMap::right_map::value_type(sid.value(), &hasher));
-    if (res->second != &hasher) {
-        hasher._hasher = nullptr;
-        hasher.unref();
-    }
-    return res->second;
+    return _hashes->insert(this, sid._sid, newID);
 }
 
 void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 {
-    _hashes->clear();
+    clear();
     std::string content;
     for (uint32_t i = 0; i < count; ++i) {
         int32_t id = 0;
@@ -762,22 +876,29 @@ void StringHasher::restoreStream(std::istream& stream, std::size_t count)
 
 void StringHasher::clear()
 {
-    for (auto& hasher : _hashes->right) {
+    HashMap::TableLock lock(*_hashes);
+    auto ids = std::move(_hashes->ids);
+    _hashes->ids.clear();
+    for (auto& shard : _hashes->shards) {
+        shard.strings.clear();
+    }
+    for (auto& hasher : ids) {
         hasher.second->_hasher = nullptr;
         hasher.second->unref();
     }
-    _hashes->clear();
 }
 
 size_t StringHasher::size() const
 {
-    return _hashes->size();
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
+    return _hashes->ids.size();
 }
 
 size_t StringHasher::count() const
 {
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
     size_t count = 0;
-    for (auto& hasher : _hashes->right) {
+    for (auto& hasher : _hashes->ids) {
         if (hasher.second->isMarked() || hasher.second->isPersistent()) {
             ++count;
         }
@@ -854,7 +975,8 @@ PyObject* StringHasher::getPyObject()
 std::map<long, StringIDRef> StringHasher::getIDMap() const
 {
     std::map<long, StringIDRef> ret;
-    for (auto& hasher : _hashes->right) {
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
+    for (auto& hasher : _hashes->ids) {
         ret.emplace_hint(ret.end(), hasher.first, StringIDRef(hasher.second));
     }
     return ret;
@@ -862,7 +984,8 @@ std::map<long, StringIDRef> StringHasher::getIDMap() const
 
 void StringHasher::clearMarks() const
 {
-    for (auto& hasher : _hashes->right) {
+    std::lock_guard<std::mutex> lock(_hashes->idMutex);
+    for (auto& hasher : _hashes->ids) {
         hasher.second->_flags.setFlag(StringID::Flag::Marked, false);
     }
 }
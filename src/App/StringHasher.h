@@ -629,6 +629,9 @@ private:
 /// If the string is longer than a given threshold, instead of storing the string, its SHA1 hash is
 /// stored (and the original string discarded). This allows an upper threshold on the length of a
 /// stored string, while still effectively guaranteeing uniqueness in the table.
+///
+/// getID() may be called concurrently from several threads. A new string gets the next free ID
+/// in the order of insertion, and the table is always saved in the order of the IDs.
 class AppExport StringHasher: public Base::Persistence, public Base::Handled
 {
 
@@ -770,7 +773,7 @@ public:
     friend class StringID;
 
 protected:
-    StringID* insert(const StringIDRef& sid);
+    StringIDRef insert(const StringIDRef& sid, bool newID = false);
     long lastID() const;
     void saveStream(std::ostream& stream) const;
     void restoreStream(std::istream& stream, std::size_t count);
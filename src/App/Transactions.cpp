@@ -109,7 +109,16 @@ int Transaction::getLastID()
 
 unsigned int Transaction::getMemSize() const
 {
-    return 0;
+    // A committed transaction does not change anymore, so the size is only
+    // computed once.
+    if (!memSizeValid) {
+        memSize = sizeof(Transaction) + Name.size();
+        for (const auto& info : _Objects.get<0>()) {
+            memSize += sizeof(Info) + info.second->getMemSize();
+        }
+        memSizeValid = true;
+    }
+    return memSize;
 }
 
 void Transaction::Save(Base::Writer& /*writer*/) const
@@ -144,6 +153,7 @@ bool Transaction::hasObject(const TransactionalObject* Obj) const
 void Transaction::changeProperty(TransactionalObject* Obj,
                                  std::function<void(TransactionObject* to)> changeFunc)
 {
+    memSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -216,6 +226,7 @@ void Transaction::apply(Document& Doc, bool forward)
 
 void Transaction::addObjectNew(TransactionalObject* Obj)
 {
+    memSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
     if (pos != index.end()) {
@@ -244,6 +255,7 @@ void Transaction::addObjectNew(TransactionalObject* Obj)
 
 void Transaction::addObjectDel(const TransactionalObject* Obj)
 {
+    memSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -264,6 +276,7 @@ void Transaction::addObjectDel(const TransactionalObject* Obj)
 
 void Transaction::addObjectChange(const TransactionalObject* Obj, const Property* Prop)
 {
+    memSizeValid = false;
     auto& index = _Objects.get<1>();
     auto pos = index.find(Obj);
 
@@ -506,7 +519,15 @@ void TransactionObject::addOrRemoveProperty(const Property* pcProp, bool add)
 
 unsigned int TransactionObject::getMemSize() const
 {
-    return 0;
+    unsigned int size = sizeof(TransactionObject) + _NameInDocument.size();
+    for (const auto& [id, data] : _PropChangeMap) {
+        size += sizeof(PropData) + data.name.size() + data.nameOrig.size();
+        // a rename does not own the property, see ~TransactionObject()
+        if (data.property && data.nameOrig.empty()) {
+            size += data.property->getMemSize();
+        }
+    }
+    return size;
 }
 
 void TransactionObject::Save(Base::Writer& /*writer*/) const
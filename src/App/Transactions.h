@@ -173,6 +173,9 @@ private:
 
 private:
     int transID;
+    // cached result of getMemSize(), reset on every change
+    mutable unsigned int memSize {0};
+    mutable bool memSizeValid {false};
     using Info = std::pair<const TransactionalObject*, TransactionObject*>;
     bmi::multi_index_container<
         Info,
@@ -55,6 +55,11 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    /// The inline files are copied by saving them.
+    bool canCopyInMemory() const override
+    {
+        return false;
+    }
 
     // NOLINTBEGIN
     PropertyFileIncluded VrmlFile;
@@ -28,9 +28,11 @@
 #pragma warning(disable : 4834)
 #endif
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -45,6 +47,9 @@
 #include <App/DocumentObserver.h>
 #include <App/StringHasher.h>
 #include <App/ExportInfo.h>
+#include <App/RecomputeCache.h>
+#include <App/RecomputeProfiler.h>
+#include <Base/TimeInfo.h>
 #include <Base/UniqueNameManager.h>
 
 // using VertexProperty = boost::property<boost::vertex_root_t, DocumentObject* >;
@@ -63,6 +68,11 @@ using Edge = Traits::edge_descriptor;
 using Node = std::vector<size_t>;
 using Path = std::vector<size_t>;
 
+namespace Base
+{
+class LazyDocFile;
+}
+
 namespace App
 {
 using HasherMap = boost::bimap<StringHasherRef, int>;
@@ -91,8 +101,23 @@ struct DocumentP
     bool committing {false};
     bool definingTransaction {false};
     bool opentransaction {false};
+    /// set while objects are recomputed concurrently by Document::recompute()
+    bool concurrentRecompute {false};
+    /// serializes document bookkeeping during a concurrent recompute
+    std::recursive_mutex concurrentMutex;
+    /// An object change signaled by Document::flushConcurrentChanges()
+    struct ConcurrentChange
+    {
+        const DocumentObject* object;
+        const Property* prop;
+        // to check the property still exists before signaling
+        std::string name;
+        bool before;
+    };
+    /// the object changes of a concurrent recompute, in the order they happened
+    std::vector<ConcurrentChange> concurrentChanges;
     std::bitset<32> StatusBits;
-    unsigned int UndoMemSize {0};
+    unsigned int UndoMemLimit {0};
     unsigned int UndoMaxStackSize {20};
     unsigned int TransactionLock {0};
     // Id and name that the next transaction will take
@@ -106,6 +131,69 @@ struct DocumentP
     ExportInfo exportInfo;
 
     StringHasherRef Hasher {new StringHasher};
+    RecomputeCache recomputeCache;
+    RecomputeProfiler recomputeProfiler;
+    // See Document::getNameGeneration()
+    std::atomic<unsigned long> nameGeneration {1};
+    // Data files whose restore is postponed until first access
+    std::vector<std::weak_ptr<Base::LazyDocFile>> lazyFiles;
+
+    /// A file of the saved archive that belongs to a property
+    struct SavedFile
+    {
+        std::string fileName;
+        long objectID {0};
+        std::string propertyName;
+    };
+    // Files of savedArchive whose property has not changed since, these
+    // are copied instead of written again by an incremental save
+    std::map<const Property*, SavedFile> savedFiles;
+    std::string savedArchive;
+    Base::TimeInfo savedArchiveTime;
+
+    /// The sorted dependency list of the last recompute
+    struct DependencyOrder
+    {
+        // The dependency epochs of the documents of the sorted objects
+        std::vector<std::pair<const Document*, unsigned long>> epochs;
+        int options {0};
+        bool fineGrained {false};
+        std::vector<DocumentObject*> objects;
+        std::vector<DocumentObject*> sorted;
+    };
+    // Reused until the dependencies change, see DocumentObject::getDependencyEpoch()
+    DependencyOrder dependencyOrder;
+
+    /// The signals deferred by Document::beginBulkUpdate()
+    struct BulkUpdate
+    {
+        struct Change
+        {
+            const PropertyContainer* container;
+            const Property* prop;
+            // to check the property still exists before signaling
+            std::string name;
+        };
+        struct NewObject
+        {
+            DocumentObject* object;
+            // the undo transaction at creation, see Document::signalTransactionAppend
+            Transaction* transaction;
+        };
+        std::vector<NewObject> newObjects;
+        std::unordered_set<const DocumentObject*> newObjectSet;
+        DocumentObject* activatedObject {nullptr};
+        // in the order of the first change of each property
+        std::vector<Change> changes;
+        std::unordered_set<const Property*> changeSet;
+
+        bool empty() const
+        {
+            return newObjects.empty() && !activatedObject && changes.empty();
+        }
+    };
+    int bulkUpdateDepth {0};
+    BulkUpdate bulkUpdate;
 
     DocumentP();
 
@@ -119,8 +207,19 @@ struct DocumentP
         addRecomputeLog(new DocumentObjectExecReturn(why, obj));
     }
 
+    /// Lock the document bookkeeping if objects are recomputed concurrently.
+    std::unique_lock<std::recursive_mutex> lockConcurrentRecompute()
+    {
+        std::unique_lock<std::recursive_mutex> lock(concurrentMutex, std::defer_lock);
+        if (concurrentRecompute) {
+            lock.lock();
+        }
+        return lock;
+    }
+
     void addRecomputeLog(DocumentObjectExecReturn* returnCode)
     {
+        auto lock = lockConcurrentRecompute();
         if (!returnCode->Which) {
             delete returnCode;
             return;
@@ -171,7 +270,15 @@ struct DocumentP
     topologicalSort(const std::vector<App::DocumentObject*>& objects) const;
     static std::vector<App::DocumentObject*>
     partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
+    std::vector<App::DocumentObject*>
+    getDependencyOrder(const std::vector<App::DocumentObject*>& objects, int options);
     static void checkStringHasher(const Base::XMLReader& reader);
+    void recordSavedFiles(
+        const Document* doc,
+        const std::string& archive,
+        const std::vector<std::pair<std::string, const Base::Persistence*>>& files
+    );
+    std::map<const Base::Persistence*, std::string> getSavedFiles(const Document* doc) const;
 };
 
 }  // namespace App
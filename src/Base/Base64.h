@@ -58,6 +58,27 @@ inline std::size_t base64_decode_size(std::size_t len)
     return len / 4 * 3;
 }
 
+/// Instruction set extensions used by base64_encode() and base64_decode()
+enum class Base64Kernel
+{
+    Scalar,
+    SSE41,
+    AVX2
+};
+
+/// Returns the kernel used by base64_encode() and base64_decode()
+BaseExport Base64Kernel base64_kernel();
+
+/** Select the kernel used by base64_encode() and base64_decode()
+ *
+ * By default the fastest kernel supported by the processor is used, so this
+ * is mainly useful for testing and benchmarking.
+ * @param kernel: the requested kernel. It is lowered to the fastest kernel
+ * supported by the processor.
+ * @return The selected kernel.
+ */
+BaseExport Base64Kernel base64_set_kernel(Base64Kernel kernel);
+
 /** Encode input binary with base64
  * @param out: output buffer with minimum size of base64_encode(len)
  * appending new data.
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <string>
 
 #include "Base64.h"
 #include "FCGlobal.h"
@@ -72,9 +75,11 @@ struct base64_encoder
 
     std::streamsize optimal_buffer_size() const
     {
+        // large enough for the vectorized codec to pay off, see base64_kernel()
         static constexpr int defaultBufferSize {1024};
+        static constexpr int linesPerBuffer {64};
         return static_cast<std::streamsize>(
-            base64_encode_size(line_size != 0U ? line_size : defaultBufferSize)
+            base64_encode_size(line_size != 0U ? line_size * linesPerBuffer : defaultBufferSize)
         );
     }
 
@@ -123,20 +128,26 @@ struct base64_encoder
 
         const char* buf = buffer.c_str();
         const char* end = buf + buffer.size();
-        if (line_size && buffer.size() >= line_size - pos) {
-            bio::write(dev, buf, line_size - pos);
-            bio::put(dev, '\n');
+        if (line_size == 0) {
+            pos += end - buf;
+            bio::write(dev, buf, end - buf);
+            buffer.clear();
+            return res;
+        }
+
+        // break the lines in a separate buffer to write downstream only once
+        lines.clear();
+        while (end - buf >= static_cast<std::streamsize>(line_size - pos)) {
+            lines.append(buf, line_size - pos);
+            lines += '\n';
             buf += line_size - pos;
             pos = 0;
-            for (; end - buf >= (int)line_size; buf += line_size) {
-                bio::write(dev, buf, line_size);
-                bio::put(dev, '\n');
-            }
         }
         pos += end - buf;
-        bio::write(dev, buf, end - buf);
+        lines.append(buf, end);
+        bio::write(dev, lines.c_str(), static_cast<std::streamsize>(lines.size()));
         buffer.clear();
-        return n;
+        return res;
     }
 
     std::size_t line_size;
@@ -144,6 +155,7 @@ struct base64_encoder
     std::size_t pending_size = 0;
     std::array<unsigned char, 3> pending {};
     std::string buffer;
+    std::string lines;
 };
 
 /** A base64 decoder that can be used as a boost iostream filter
@@ -170,17 +182,17 @@ struct base64_decoder
 
     std::streamsize optimal_buffer_size() const
     {
+        // large enough for the vectorized codec to pay off, see base64_kernel()
         static constexpr int defaultBufferSize {1024};
+        static constexpr int linesPerBuffer {64};
         return static_cast<std::streamsize>(
-            base64_encode_size(line_size != 0U ? line_size : defaultBufferSize)
+            base64_encode_size(line_size != 0U ? line_size * linesPerBuffer : defaultBufferSize)
         );
     }
 
     template<typename Device>
     std::streamsize read(Device& dev, char_type* str, std::streamsize n)
     {
-        static auto table = base64_decode_table();
-
         if (!n) {
             return 0;
         }
@@ -188,10 +200,12 @@ struct base64_decoder
         std::streamsize count = 0;
 
         for (;;) {
-            while (pending_out < out_count) {
-                *str++ = char_array_3[pending_out++];
-                ++count;
-                if (--n == 0) {
+            if (pending_out < decoded.size()) {
+                auto size = std::min<std::size_t>(n - count, decoded.size() - pending_out);
+                std::memcpy(str + count, decoded.data() + pending_out, size);
+                pending_out += size;
+                count += static_cast<std::streamsize>(size);
+                if (count == n) {
                     return count;
                 }
             }
@@ -200,52 +214,62 @@ struct base64_decoder
                 return count ? count : -1;
             }
 
-            for (;;) {
-                int newChar = bio::get(dev);
-                if (newChar < 0) {
-                    eof = true;
-                    if (pending_in <= 1) {
-                        if (pending_in == 1 && errHandling == Base64ErrorHandling::throws) {
-                            throw BOOST_IOSTREAMS_FAILURE("Unexpected ending of base64 string");
-                        }
-                        return count ? count : -1;
-                    }
-                    out_count = pending_in - 1;
-                    pending_in = 4;
-                }
-                else {
-                    signed char decodedChar = table[newChar];
-                    if (decodedChar < 0) {
-                        if (decodedChar == -2 || errHandling == Base64ErrorHandling::silent) {
-                            continue;
-                        }
-                        throw BOOST_IOSTREAMS_FAILURE("Invalid character in base64 string");
-                    }
-                    char_array_4[pending_in++] = (char)decodedChar;
-                }
-                if (pending_in == 4) {
-                    pending_out = pending_in = 0;
-                    char_array_3[0] = static_cast<char>(
-                        (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4)
-                    );
-                    char_array_3[1] = static_cast<char>(
-                        ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2)
-                    );
-                    char_array_3[2] = static_cast<char>(
-                        ((char_array_4[2] & 0x3) << 6) + char_array_4[3]
-                    );
-                    break;
+            fill(dev);
+        }
+    }
+
+    /// Read the next chunk of upstream and decode all complete groups of four characters
+    template<typename Device>
+    void fill(Device& dev)
+    {
+        static auto table = base64_decode_table();
+        static constexpr std::size_t chunkSize {4096};
+
+        decoded.clear();
+        pending_out = 0;
+
+        chunk.resize(chunkSize);
+        std::streamsize size = bio::read(dev, chunk.data(), static_cast<std::streamsize>(chunkSize));
+        if (size < 0) {
+            eof = true;
+            if (encoded.size() == 1 && errHandling == Base64ErrorHandling::throws) {
+                throw BOOST_IOSTREAMS_FAILURE("Unexpected ending of base64 string");
+            }
+            if (!encoded.empty()) {
+                // pad the last group, so that the output buffer is sized correctly
+                encoded.append(4 - encoded.size() % 4, '=');
+                base64_decode(decoded, encoded.data(), encoded.size());
+                encoded.clear();
+            }
+            return;
+        }
+
+        // Drop white space and padding, so that the remaining characters can
+        // be decoded in one go.
+        std::size_t kept = encoded.size();
+        encoded.resize(kept + static_cast<std::size_t>(size));
+        for (std::streamsize i = 0; i < size; ++i) {
+            signed char decodedChar = table[static_cast<unsigned char>(chunk[i])];
+            if (decodedChar < 0) {
+                if (decodedChar == -2 || errHandling == Base64ErrorHandling::silent) {
+                    continue;
                 }
+                throw BOOST_IOSTREAMS_FAILURE("Invalid character in base64 string");
             }
+            encoded[kept++] = chunk[i];
         }
+        encoded.resize(kept);
+
+        std::size_t groups = encoded.size() / 4 * 4;
+        base64_decode(decoded, encoded.data(), groups);
+        encoded.erase(0, groups);
     }
 
     std::size_t line_size;
-    std::uint8_t pending_in = 0;
-    std::array<char, 4> char_array_4 {};
-    std::uint8_t pending_out = 3;
-    std::uint8_t out_count = 3;
-    std::array<char, 3> char_array_3 {};
+    std::string chunk;
+    std::string encoded;
+    std::string decoded;
+    std::size_t pending_out = 0;
     Base64ErrorHandling errHandling;
     bool eof = false;
 };
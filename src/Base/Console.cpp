@@ -27,11 +27,17 @@
 
 #if defined(FC_OS_WIN32)
 # include <windows.h>
+# include <io.h>
 #elif defined(FC_OS_LINUX) || defined(FC_OS_MACOSX)
 # include <unistd.h>
 #endif
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <thread>
 
 #include "Console.h"
 #include "PyObjectBase.h"
@@ -40,6 +46,269 @@
 using namespace Base;
 
 
+//=========================================================================
+// Asynchronous mode
+
+struct ConsoleSingleton::AsyncEntry
+{
+    LogStyle category {};
+    IntendedRecipient recipient {};
+    ContentType content {};
+    std::string notifier;
+    std::string msg;
+};
+
+/** A bounded multi-producer single-consumer queue with its consumer thread.
+ *  Every cell carries a sequence number telling whether it is free for the
+ *  producer at a given position or filled for the consumer, so producers only
+ *  need a compare-and-swap on the enqueue position.
+ */
+class ConsoleSingleton::AsyncQueue
+{
+public:
+    using Deliver = std::function<void(const std::vector<AsyncEntry>&)>;
+
+    explicit AsyncQueue(const std::size_t capacity)
+        : cells(std::bit_ceil(std::max<std::size_t>(capacity, 2)))
+        , mask(cells.size() - 1)
+    {
+        for (std::size_t i = 0; i < cells.size(); ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~AsyncQueue()
+    {
+        stop();
+    }
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue(AsyncQueue&&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(AsyncQueue&&) = delete;
+
+    void start(Deliver func)
+    {
+        stop();
+        deliver = std::move(func);
+        running = true;
+        worker = std::thread([this] {
+            workerId.store(std::this_thread::get_id(), std::memory_order_release);
+            run();
+        });
+    }
+
+    /// Stops the thread and returns the messages it did not deliver.
+    std::vector<AsyncEntry> stop()
+    {
+        std::vector<AsyncEntry> pending;
+        if (!worker.joinable()) {
+            return pending;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        wakeup.notify_one();
+        worker.join();
+
+        // A producer may have seen the thread running just before it stopped,
+        // wait until it either queued its message or gave up
+        while (producers.load() != 0) {
+            std::this_thread::yield();
+        }
+        AsyncEntry entry;
+        while (tryPop(entry)) {
+            pending.push_back(std::move(entry));
+        }
+        delivered.store(enqueuePos.load(std::memory_order_acquire), std::memory_order_release);
+        flushed.notify_all();
+        return pending;
+    }
+
+    /// Queues a message, returns false if the thread is not running.
+    bool push(AsyncEntry&& entry)
+    {
+        ++producers;
+        if (!running) {
+            --producers;
+            return false;
+        }
+        while (!tryPush(entry)) {
+            if (!running) {
+                --producers;
+                return false;
+            }
+            // full, let the consumer catch up
+            wakeup.notify_one();
+            std::this_thread::yield();
+        }
+        --producers;
+        if (idle.load(std::memory_order_acquire)) {
+            wakeup.notify_one();
+        }
+        return true;
+    }
+
+    void flush()
+    {
+        const std::size_t target = enqueuePos.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(mutex);
+        wakeup.notify_one();
+        flushed.wait(lock, [this, target] {
+            return !running || delivered.load(std::memory_order_acquire) >= target;
+        });
+    }
+
+    bool isWorkerThread() const
+    {
+        return std::this_thread::get_id() == workerId.load(std::memory_order_acquire);
+    }
+
+    /// Writes the queued messages to \a fd without locking or allocating.
+    void writeRaw(const int fd) noexcept
+    {
+        std::size_t pos {};
+        while (Cell* cell = claim(pos)) {
+            const std::string& msg = cell->entry.msg;
+            const char* data = msg.data();
+            std::size_t size = msg.size();
+            while (size > 0) {
+#if defined(FC_OS_WIN32)
+                const auto written = _write(fd, data, static_cast<unsigned int>(size));
+#else
+                const auto written = ::write(fd, data, size);
+#endif
+                if (written <= 0) {
+                    break;
+                }
+                data += written;
+                size -= static_cast<std::size_t>(written);
+            }
+            cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        }
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        AsyncEntry entry;
+    };
+
+    bool tryPush(AsyncEntry& entry)
+    {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell {};
+        for (;;) {
+            cell = &cells[pos & mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->entry = std::move(entry);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Claims the oldest filled cell at \a pos, the caller frees it afterwards.
+     *  Besides the consumer thread a crash handler may claim cells, see writeRaw().
+     */
+    Cell* claim(std::size_t& pos) noexcept
+    {
+        pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell* cell = &cells[pos & mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return cell;
+                }
+            }
+            else if (diff < 0) {
+                return nullptr;
+            }
+            else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool tryPop(AsyncEntry& entry)
+    {
+        std::size_t pos {};
+        Cell* cell = claim(pos);
+        if (!cell) {
+            return false;
+        }
+        entry = std::move(cell->entry);
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    void run()
+    {
+        constexpr std::size_t maxBatch = 256;
+        std::vector<AsyncEntry> batch;
+        batch.reserve(maxBatch);
+        for (;;) {
+            AsyncEntry entry;
+            while (batch.size() < maxBatch && tryPop(entry)) {
+                batch.push_back(std::move(entry));
+            }
+            if (!batch.empty()) {
+                deliver(batch);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    delivered.fetch_add(batch.size(), std::memory_order_release);
+                }
+                flushed.notify_all();
+                batch.clear();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!running) {
+                break;
+            }
+            // Producers do not take the mutex, so a wakeup may get lost.
+            // The timeout bounds the resulting delay.
+            idle.store(true, std::memory_order_release);
+            wakeup.wait_for(lock, std::chrono::milliseconds(10));
+            idle.store(false, std::memory_order_release);
+        }
+    }
+
+    std::vector<Cell> cells;
+    const std::size_t mask;
+    std::atomic<std::size_t> enqueuePos {0};
+    std::atomic<std::size_t> dequeuePos {0};
+    std::atomic<std::size_t> delivered {0};
+    std::atomic<bool> idle {false};
+    std::atomic<bool> running {false};
+    // the producers inside push(), stop() drains the queue once they left
+    std::atomic<int> producers {0};
+
+    Deliver deliver;
+    std::thread worker;
+    std::atomic<std::thread::id> workerId;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable flushed;
+};
+
+
 //=========================================================================
 
 //**************************************************************************
@@ -56,6 +325,7 @@ ConsoleSingleton::ConsoleSingleton()
 
 ConsoleSingleton::~ConsoleSingleton()
 {
+    setAsyncMode(false);
     for (ILogger* Iter : _aclObservers) {  // NOLINT
         delete Iter;
     }
@@ -189,6 +459,7 @@ void ConsoleSingleton::attachObserver(ILogger* pcObserver)
     // double insert !!
     assert(!_aclObservers.contains(pcObserver));
 
+    std::lock_guard<std::mutex> lock(_observerMutex);
     _aclObservers.insert(pcObserver);
 }
 
@@ -199,9 +470,68 @@ void ConsoleSingleton::attachObserver(ILogger* pcObserver)
  */
 void ConsoleSingleton::detachObserver(ILogger* pcObserver)
 {
+    std::lock_guard<std::mutex> lock(_observerMutex);
     _aclObservers.erase(pcObserver);
 }
 
+void ConsoleSingleton::setAsyncMode(const bool on, const std::size_t capacity)
+{
+    if (on == isAsyncMode()) {
+        return;
+    }
+
+    if (on) {
+        if (!_asyncQueue) {
+            _asyncQueue = std::make_unique<AsyncQueue>(capacity);
+        }
+        // exit() does not destroy the console, so deliver the pending messages before
+        static std::once_flag flushAtExit;
+        std::call_once(flushAtExit, [] {
+            std::atexit([] { Console().flush(); });
+        });
+        _asyncQueue->start([this](const std::vector<AsyncEntry>& entries) {
+            deliverAsync(entries);
+        });
+        _asyncMode.store(true, std::memory_order_release);
+    }
+    else {
+        _asyncMode.store(false, std::memory_order_release);
+        deliverAsync(_asyncQueue->stop());
+    }
+}
+
+bool ConsoleSingleton::isAsyncMode() const
+{
+    return _asyncMode.load(std::memory_order_acquire);
+}
+
+void ConsoleSingleton::flush()
+{
+    // the background thread cannot wait for itself
+    if (isAsyncMode() && !_asyncQueue->isWorkerThread()) {
+        _asyncQueue->flush();
+    }
+}
+
+void ConsoleSingleton::writePendingRaw(const int fd) noexcept
+{
+    if (isAsyncMode()) {
+        _asyncQueue->writeRaw(fd);
+    }
+}
+
+void ConsoleSingleton::deliverAsync(const std::vector<AsyncEntry>& entries) const
+{
+    std::lock_guard<std::mutex> lock(_observerMutex);
+    for (const auto& entry : entries) {
+        for (ILogger* Iter : _aclObservers) {
+            if (Iter->isThreadSafe() && Iter->isActive(entry.category)) {
+                Iter->sendLog(entry.notifier, entry.msg, entry.category, entry.recipient, entry.content);
+            }
+        }
+    }
+}
+
 void ConsoleSingleton::notifyPrivate(
     const LogStyle category,
     const IntendedRecipient recipient,
@@ -210,8 +540,16 @@ void ConsoleSingleton::notifyPrivate(
     const std::string& msg
 ) const
 {
+    // Messages sent from the background thread itself are delivered directly,
+    // waiting for free space in the queue would block it forever.
+    bool async = isAsyncMode() && !_asyncQueue->isWorkerThread();
+    bool queued = false;
     for (ILogger* Iter : _aclObservers) {
         if (Iter->isActive(category)) {
+            if (async && Iter->isThreadSafe()) {
+                queued = true;
+                continue;
+            }
             Iter->sendLog(
                 notifiername,
                 msg,
@@ -221,6 +559,13 @@ void ConsoleSingleton::notifyPrivate(
             );  // send string to the listener
         }
     }
+
+    if (queued) {
+        AsyncEntry entry {category, recipient, content, notifiername, msg};
+        if (!_asyncQueue->push(std::move(entry))) {
+            deliverAsync({std::move(entry)});
+        }
+    }
 }
 
 void ConsoleSingleton::postEvent(
@@ -32,10 +32,12 @@
 #include <chrono>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
 #include <sstream>
+#include <vector>
 #include <FCGlobal.h>
 
 #include <fmt/printf.h>
@@ -386,6 +388,16 @@ public:
     {
         return nullptr;
     }
+
+    /**
+     * Returns whether the observer may be called from the background thread of the
+     * asynchronous console mode. Such observers must not access any GUI elements.
+     */
+    virtual bool isThreadSafe() const
+    {
+        return false;
+    }
+
     bool bErr {true};
     bool bMsg {true};
     bool bLog {true};
@@ -576,6 +588,25 @@ public:
     /// Detaches an Observer from FCConsole
     void detachObserver(ILogger* pcObserver);
 
+    /** Enables or disables the asynchronous mode.
+     *  In asynchronous mode the messages for thread safe observers are put into a bounded
+     *  lock-free queue and are delivered in order by a background thread, all other observers
+     *  are still notified directly. When the queue is full the sender waits for free space.
+     *  The capacity is only used when the mode is enabled for the first time. Disabling the
+     *  mode delivers all pending messages.
+     */
+    void setAsyncMode(bool on, std::size_t capacity = 8192);
+    /// Checks if the asynchronous mode is enabled
+    bool isAsyncMode() const;
+    /// Waits until all pending messages of the asynchronous mode are delivered
+    void flush();
+    /** Writes the pending messages of the asynchronous mode unformatted to the file
+     *  descriptor @p fd instead of delivering them to the observers. It neither blocks
+     *  nor allocates, so a signal handler can call it. Messages the background thread
+     *  is just delivering may get lost.
+     */
+    void writePendingRaw(int fd) noexcept;
+
     /// enumeration for the console modes
     enum ConsoleMode
     {
@@ -675,6 +706,12 @@ private:
     bool _bCanRefresh {true};
     ConnectionMode connectionMode {Direct};
 
+    struct AsyncEntry;
+    class AsyncQueue;
+    std::unique_ptr<AsyncQueue> _asyncQueue;
+    std::atomic<bool> _asyncMode {false};
+    mutable std::mutex _observerMutex;
+
     std::atomic<const Bridge*> _bridge {nullptr};
     mutable std::mutex _handlerMutex;
     PostEventHandler _postEventHandler;
@@ -705,6 +742,7 @@ private:
         const std::string& notifiername,
         const std::string& msg
     ) const;
+    void deliverAsync(const std::vector<AsyncEntry>& entries) const;
 
     // singleton
     static void Destruct();
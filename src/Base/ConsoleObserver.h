@@ -55,6 +55,10 @@ public:
     {
         return "File";
     }
+    bool isThreadSafe() const override
+    {
+        return true;
+    }
 
     ConsoleObserverFile(const ConsoleObserverFile&) = delete;
     ConsoleObserverFile(ConsoleObserverFile&&) = delete;
@@ -84,6 +88,10 @@ public:
     {
         return "Console";
     }
+    bool isThreadSafe() const override
+    {
+        return true;
+    }
 
     ConsoleObserverStd(const ConsoleObserverStd&) = delete;
     ConsoleObserverStd(ConsoleObserverStd&&) = delete;
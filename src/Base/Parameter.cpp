@@ -187,7 +187,9 @@ ParameterGrp::ParameterGrp(DOMElement* GroupNode, const char* sName, ParameterGr
  */
 ParameterGrp::~ParameterGrp()
 {
+    _DropPending();
     for (auto& v : _GroupMap) {
+        v.second->_DropPending();
         v.second->_Parent = nullptr;
         v.second->_Manager = nullptr;
     }
@@ -680,6 +682,135 @@ void ParameterGrp::_Notify(ParamType Type, const char* Name, const char* Value)
     }
 }
 
+ParameterGrp::CacheValue ParameterGrp::_ParseValue(ParamType Type, const char* Value)
+{
+    const int base = 10;
+    switch (Type) {
+        case ParamType::FCBool:
+            return strcmp(Value, "1") == 0;
+        case ParamType::FCInt:
+            return atol(Value);
+        case ParamType::FCUInt:
+            return strtoul(Value, nullptr, base);
+        case ParamType::FCFloat:
+            return atof(Value);
+        case ParamType::FCText:
+            return std::string(Value);
+        default:
+            return {};
+    }
+}
+
+ParameterGrp::CacheValue ParameterGrp::_GetCached(ParamType Type, const char* Name) const
+{
+    if (!_pGroupNode || Type == ParamType::FCInvalid || Type == ParamType::FCGroup) {
+        return {};
+    }
+
+    // The lock also serializes the DOM access of concurrent readers
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    Cache& cache = _Cache[static_cast<std::size_t>(Type) - 1];
+    auto it = cache.find(std::string_view(Name));
+    if (it == cache.end()) {
+        it = cache.emplace(Name, _ReadValue(Type, Name)).first;
+    }
+    return it->second;
+}
+
+ParameterGrp::CacheValue ParameterGrp::_ReadValue(ParamType Type, const char* Name) const
+{
+    // check if Element in group
+    DOMElement* pcElem = FindElement(_pGroupNode, TypeName(Type), Name);
+    if (!pcElem) {
+        return {};
+    }
+
+    if (Type == ParamType::FCText) {
+        DOMNode* pcElem2 = pcElem->getFirstChild();
+        if (pcElem2) {
+            return std::string(StrXUTF8(pcElem2->getNodeValue()).c_str());
+        }
+        return std::string();
+    }
+    return _ParseValue(Type, StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+}
+
+void ParameterGrp::_SetCached(ParamType Type, const char* Name, const char* Value) const
+{
+    if (Type == ParamType::FCInvalid || Type == ParamType::FCGroup) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    Cache& cache = _Cache[static_cast<std::size_t>(Type) - 1];
+    cache.insert_or_assign(std::string(Name), Value ? _ParseValue(Type, Value) : CacheValue());
+}
+
+void ParameterGrp::_ClearCache() const
+{
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    for (auto& cache : _Cache) {
+        cache.clear();
+    }
+}
+
+bool ParameterGrp::_DeferWrite(ParamType Type, const char* Name, const char* Value)
+{
+    if (!_Manager || _Manager->_UpdateCount == 0) {
+        return false;
+    }
+
+    if (_Pending.empty()) {
+        _Manager->_PendingGroups.push_back(this);
+    }
+    _Pending[std::make_pair(Type, std::string(Name))] = Value;
+    _SetCached(Type, Name, Value);
+    return true;
+}
+
+void ParameterGrp::_WritePending()
+{
+    // the caller already removed this group from the list of the manager
+    auto pending = std::move(_Pending);
+    _Pending.clear();
+    for (const auto& [key, value] : pending) {
+        if (key.first == ParamType::FCText) {
+            SetASCII(key.second.c_str(), value.c_str());
+        }
+        else {
+            _SetAttribute(key.first, key.second.c_str(), value.c_str());
+        }
+    }
+}
+
+void ParameterGrp::_ErasePending(ParamType Type, const char* Name)
+{
+    if (_Pending.erase(std::make_pair(Type, std::string(Name))) == 0) {
+        return;
+    }
+    if (_Pending.empty() && _Manager) {
+        std::erase(_Manager->_PendingGroups, this);
+    }
+
+    // the cached value may not be in the DOM yet
+    std::lock_guard<std::mutex> lock(_CacheMutex);
+    Cache& cache = _Cache[static_cast<std::size_t>(Type) - 1];
+    if (auto it = cache.find(std::string_view(Name)); it != cache.end()) {
+        cache.erase(it);
+    }
+}
+
+void ParameterGrp::_DropPending()
+{
+    if (_Pending.empty()) {
+        return;
+    }
+    _Pending.clear();
+    if (_Manager) {
+        std::erase(_Manager->_PendingGroups, this);
+    }
+}
+
 void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Value)
 {
     const char* Type = TypeName(T);
@@ -698,6 +829,9 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         }
         return;
     }
+    if (_DeferWrite(T, Name, Value)) {
+        return;
+    }
 
     // find or create the Element
     DOMElement* pcElem = FindOrCreateElement(_pGroupNode, Type, Name);
@@ -706,6 +840,7 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
         // set the value only if different
         if (strcmp(StrX(pcElem->getAttribute(attr.unicodeForm())).c_str(), Value) != 0) {
             pcElem->setAttribute(attr.unicodeForm(), XStr(Value).unicodeForm());
+            _SetCached(T, Name, Value);
             // trigger observer
             _Notify(T, Name, Value);
         }
@@ -717,19 +852,11 @@ void ParameterGrp::_SetAttribute(ParamType T, const char* Name, const char* Valu
 
 bool ParameterGrp::GetBool(const char* Name, bool bPreset) const
 {
-    if (!_pGroupNode) {
-        return bPreset;
-    }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
-    // if not return preset
-    if (!pcElem) {
-        return bPreset;
+    CacheValue value = _GetCached(ParamType::FCBool, Name);
+    if (const auto* res = std::get_if<bool>(&value)) {
+        return *res;
     }
-
-    // if yes check the value and return
-    return (strcmp(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), "1") == 0);
+    return bPreset;
 }
 
 void ParameterGrp::SetBool(const char* Name, bool bValue)
@@ -795,18 +922,11 @@ std::vector<std::pair<std::string, bool>> ParameterGrp::GetBoolMap(const char* s
 
 long ParameterGrp::GetInt(const char* Name, long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
+    CacheValue value = _GetCached(ParamType::FCInt, Name);
+    if (const auto* res = std::get_if<long>(&value)) {
+        return *res;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-    // if yes check the value and return
-    return atol(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return lPreset;
 }
 
 void ParameterGrp::SetInt(const char* Name, long lValue)
@@ -866,20 +986,11 @@ std::vector<std::pair<std::string, long>> ParameterGrp::GetIntMap(const char* sF
 
 unsigned long ParameterGrp::GetUnsigned(const char* Name, unsigned long lPreset) const
 {
-    if (!_pGroupNode) {
-        return lPreset;
+    CacheValue value = _GetCached(ParamType::FCUInt, Name);
+    if (const auto* res = std::get_if<unsigned long>(&value)) {
+        return *res;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
-    // if not return preset
-    if (!pcElem) {
-        return lPreset;
-    }
-
-    // if yes check the value and return
-    const int base = 10;
-    return strtoul(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str(), nullptr, base);
+    return lPreset;
 }
 
 void ParameterGrp::SetUnsigned(const char* Name, unsigned long lValue)
@@ -947,18 +1058,11 @@ std::vector<std::pair<std::string, unsigned long>> ParameterGrp::GetUnsignedMap(
 
 double ParameterGrp::GetFloat(const char* Name, double dPreset) const
 {
-    if (!_pGroupNode) {
-        return dPreset;
+    CacheValue value = _GetCached(ParamType::FCFloat, Name);
+    if (const auto* res = std::get_if<double>(&value)) {
+        return *res;
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
-    // if not return preset
-    if (!pcElem) {
-        return dPreset;
-    }
-    // if yes check the value and return
-    return atof(StrX(pcElem->getAttribute(XStrLiteral("Value").unicodeForm())).c_str());
+    return dPreset;
 }
 
 void ParameterGrp::SetFloat(const char* Name, double dValue)
@@ -1032,6 +1136,9 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
         }
         return;
     }
+    if (_DeferWrite(ParamType::FCText, Name, sValue)) {
+        return;
+    }
 
     bool isNew = false;
     DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
@@ -1046,12 +1153,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
             DOMDocument* pDocument = _pGroupNode->getOwnerDocument();
             DOMText* pText = pDocument->createTextNode(XUTF8Str(sValue).unicodeForm());
             pcElem->appendChild(pText);
+            _SetCached(ParamType::FCText, Name, sValue);
             if (isNew || sValue[0] != 0) {
                 _Notify(ParamType::FCText, Name, sValue);
             }
         }
         else if (strcmp(StrXUTF8(pcElem2->getNodeValue()).c_str(), sValue) != 0) {
             pcElem2->setNodeValue(XUTF8Str(sValue).unicodeForm());
+            _SetCached(ParamType::FCText, Name, sValue);
             _Notify(ParamType::FCText, Name, sValue);
         }
         // trigger observer
@@ -1061,25 +1170,14 @@ void ParameterGrp::SetASCII(const char* Name, const char* sValue)
 
 std::string ParameterGrp::GetASCII(const char* Name, const char* pPreset) const
 {
-    if (!_pGroupNode) {
-        return pPreset ? pPreset : "";
+    CacheValue value = _GetCached(ParamType::FCText, Name);
+    if (auto* res = std::get_if<std::string>(&value)) {
+        return std::move(*res);
     }
-
-    // check if Element in group
-    DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
-    // if not return preset
-    if (!pcElem) {
-        if (!pPreset) {
-            return {};
-        }
-        return {pPreset};
-    }
-    // if yes check the value and return
-    DOMNode* pcElem2 = pcElem->getFirstChild();
-    if (pcElem2) {
-        return {StrXUTF8(pcElem2->getNodeValue()).c_str()};
+    if (!pPreset) {
+        return {};
     }
-    return {};
+    return {pPreset};
 }
 
 std::vector<std::string> ParameterGrp::GetASCIIs(const char* sFilter) const
@@ -1151,6 +1249,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
     if (!_pGroupNode) {
         return;
     }
+    _ErasePending(ParamType::FCText, Name);
 
     // check if Element in group
     DOMElement* pcElem = FindElement(_pGroupNode, "FCText", Name);
@@ -1161,6 +1260,7 @@ void ParameterGrp::RemoveASCII(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCached(ParamType::FCText, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCText, Name, nullptr);
@@ -1172,6 +1272,7 @@ void ParameterGrp::RemoveBool(const char* Name)
     if (!_pGroupNode) {
         return;
     }
+    _ErasePending(ParamType::FCBool, Name);
 
     // check if Element in group
     DOMElement* pcElem = FindElement(_pGroupNode, "FCBool", Name);
@@ -1182,6 +1283,7 @@ void ParameterGrp::RemoveBool(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCached(ParamType::FCBool, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCBool, Name, nullptr);
@@ -1194,6 +1296,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
     if (!_pGroupNode) {
         return;
     }
+    _ErasePending(ParamType::FCFloat, Name);
 
     // check if Element in group
     DOMElement* pcElem = FindElement(_pGroupNode, "FCFloat", Name);
@@ -1204,6 +1307,7 @@ void ParameterGrp::RemoveFloat(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCached(ParamType::FCFloat, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCFloat, Name, nullptr);
@@ -1215,6 +1319,7 @@ void ParameterGrp::RemoveInt(const char* Name)
     if (!_pGroupNode) {
         return;
     }
+    _ErasePending(ParamType::FCInt, Name);
 
     // check if Element in group
     DOMElement* pcElem = FindElement(_pGroupNode, "FCInt", Name);
@@ -1225,6 +1330,7 @@ void ParameterGrp::RemoveInt(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCached(ParamType::FCInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCInt, Name, nullptr);
@@ -1236,6 +1342,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
     if (!_pGroupNode) {
         return;
     }
+    _ErasePending(ParamType::FCUInt, Name);
 
     // check if Element in group
     DOMElement* pcElem = FindElement(_pGroupNode, "FCUInt", Name);
@@ -1246,6 +1353,7 @@ void ParameterGrp::RemoveUnsigned(const char* Name)
 
     DOMNode* node = _pGroupNode->removeChild(pcElem);
     node->release();
+    _SetCached(ParamType::FCUInt, Name, nullptr);
 
     // trigger observer
     _Notify(ParamType::FCUInt, Name, nullptr);
@@ -1369,6 +1477,7 @@ void ParameterGrp::Clear(bool notify)
     }
 
     Base::StateLocker guard(_Clearing);
+    _DropPending();
 
     // early trigger notification of group removal when all its children
     // hierarchies are intact.
@@ -1412,6 +1521,7 @@ void ParameterGrp::Clear(bool notify)
         DOMNode* node = _pGroupNode->removeChild(child);
         node->release();
     }
+    _ClearCache();
 
     for (auto& v : params) {
         _Notify(v.first, v.second.c_str(), nullptr);
@@ -1582,6 +1692,8 @@ void ParameterGrp::NotifyAll()
 
 void ParameterGrp::_Reset()
 {
+    _DropPending();
+    _ClearCache();
     _pGroupNode = nullptr;
     for (auto& v : _GroupMap) {
         v.second->_Reset();
@@ -1791,6 +1903,26 @@ bool ParameterManager::IgnoreSave() const
     return gIgnoreSave;
 }
 
+void ParameterManager::BeginUpdate()
+{
+    ++_UpdateCount;
+}
+
+void ParameterManager::EndUpdate()
+{
+    if (_UpdateCount == 0 || --_UpdateCount > 0) {
+        return;
+    }
+
+    // A group leaves the list before writing, so a group destroyed by an
+    // observer in the meantime removes itself from the list.
+    while (!_PendingGroups.empty()) {
+        ParameterGrp* grp = _PendingGroups.front();
+        _PendingGroups.erase(_PendingGroups.begin());
+        grp->_WritePending();
+    }
+}
+
 namespace
 {
 std::string getLockFile(const Base::FileInfo& file)
@@ -1919,6 +2051,7 @@ int ParameterManager::LoadDocument(const XERCES_CPP_NAMESPACE::InputSource& inpu
     }
 
     _pGroupNode = FindElement(rootElem, "FCParamGroup", "Root");
+    _ClearCache();
 
     if (!_pGroupNode) {
         throw XMLBaseException("Malformed Parameter document: Root group not found");
@@ -2046,6 +2179,7 @@ void ParameterManager::CreateDocument()
     _pGroupNode = _pDocument->createElement(XStrLiteral("FCParamGroup").unicodeForm());
     _pGroupNode->setAttribute(XStrLiteral("Name").unicodeForm(), XStrLiteral("Root").unicodeForm());
     rootElem->appendChild(_pGroupNode);
+    _ClearCache();
 }
 
 void ParameterManager::CheckDocument() const
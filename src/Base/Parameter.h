@@ -48,7 +48,14 @@ using PyObject = struct _object;
 # undef isalnum
 #endif
 
+#include <array>
 #include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
 #include <vector>
 #include <fastsignals/signal.h>
 #include <xercesc/util/XercesDefs.hpp>
@@ -441,6 +448,22 @@ protected:
     void _SetAttribute(ParamType Type, const char* Name, const char* Value);
     void _Notify(ParamType Type, const char* Name, const char* Value);
 
+    /// The typed value of a parameter, std::monostate if the parameter does not exist
+    using CacheValue = std::variant<std::monostate, bool, long, unsigned long, double, std::string>;
+    static CacheValue _ParseValue(ParamType Type, const char* Value);
+    /// Returns the value from the cache, reads it from the DOM on the first access
+    CacheValue _GetCached(ParamType Type, const char* Name) const;
+    CacheValue _ReadValue(ParamType Type, const char* Name) const;
+    /// Updates the cache after a change, a null value marks the parameter as removed
+    void _SetCached(ParamType Type, const char* Name, const char* Value) const;
+    void _ClearCache() const;
+
+    /// Keeps the value until the manager ends the update, returns false if it does not defer
+    bool _DeferWrite(ParamType Type, const char* Name, const char* Value);
+    void _WritePending();
+    void _ErasePending(ParamType Type, const char* Name);
+    void _DropPending();
+
     XERCES_CPP_NAMESPACE::DOMElement* FindNextElement(
         XERCES_CPP_NAMESPACE::DOMNode* Prev,
         const char* Type
@@ -497,6 +520,21 @@ protected:
      * This is used to prevent anynew value/sub-group to be added in observer
      */
     bool _Clearing = false;
+
+    struct CacheHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const
+        {
+            return std::hash<std::string_view> {}(name);
+        }
+    };
+    using Cache = std::unordered_map<std::string, CacheValue, CacheHash, std::equal_to<>>;
+    /// Values read so far, one map for each parameter type except groups
+    mutable std::array<Cache, 5> _Cache;
+    mutable std::mutex _CacheMutex;
+    /// Values set while the manager defers updates
+    std::map<std::pair<ParamType, std::string>, std::string> _Pending;
 };
 
 /** The parameter serializer class
@@ -594,7 +632,27 @@ public:
     bool IgnoreSave() const;
     //@}
 
+    /** @name Deferred updates */
+    //@{
+    /** Starts deferring updates.
+     *  Until the matching EndUpdate() the values set in any group of this manager are only
+     *  kept in the group, so reading them already returns the new value. The last EndUpdate()
+     *  writes the values into the DOM and notifies every changed parameter once with its
+     *  final value. Functions returning all values of a group, like GetBoolMap(), only see
+     *  the new values after the update ended. Removing parameters or groups is not deferred.
+     */
+    void BeginUpdate();
+    /// Ends deferring updates, see BeginUpdate()
+    void EndUpdate();
+    //@}
+
 private:
+    friend class ParameterGrp;
+
+    int _UpdateCount {0};
+    /// groups with values kept by BeginUpdate()
+    std::vector<ParameterGrp*> _PendingGroups;
+
     XERCES_CPP_NAMESPACE::DOMDocument* _pDocument {nullptr};
     ParameterSerializer* paramSerializer {nullptr};
 
@@ -625,6 +683,31 @@ public:
     ParameterManager& operator=(ParameterManager&&) = delete;
 };
 
+/** Defers the updates of a parameter manager during its lifetime
+ *  @see ParameterManager::BeginUpdate()
+ */
+class ParameterUpdateLocker
+{
+public:
+    explicit ParameterUpdateLocker(ParameterManager* manager)
+        : manager(manager)
+    {
+        manager->BeginUpdate();
+    }
+    ~ParameterUpdateLocker()
+    {
+        manager->EndUpdate();
+    }
+
+    ParameterUpdateLocker(const ParameterUpdateLocker&) = delete;
+    ParameterUpdateLocker(ParameterUpdateLocker&&) = delete;
+    ParameterUpdateLocker& operator=(const ParameterUpdateLocker&) = delete;
+    ParameterUpdateLocker& operator=(ParameterUpdateLocker&&) = delete;
+
+private:
+    Base::Reference<ParameterManager> manager;
+};
+
 /** python wrapper function
  */
 BaseExport PyObject* GetPyObject(const Base::Reference<ParameterGrp>& hcParamGrp);
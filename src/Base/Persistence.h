@@ -25,10 +25,13 @@
 
 #pragma once
 
+#include <memory>
+
 #include "BaseClass.h"
 
 namespace Base
 {
+class LazyDocFile;
 class Reader;
 class Writer;
 class XMLReader;
@@ -116,6 +119,16 @@ public:
      * ostream).
      */
     virtual void SaveDocFile(Writer& /*writer*/) const;
+    /** Tells whether SaveDocFile() may run on a worker thread.
+     * A writer that saves with several threads serializes such objects
+     * concurrently into a private writer. The implementation must then only
+     * read its own data and must not call Writer::addFile(). The default
+     * implementation returns false.
+     */
+    virtual bool canSaveDocFileConcurrently() const
+    {
+        return false;
+    }
     /** This method is used to restore large amounts of data from a file
      * In this method you simply stream in your SaveDocFile() saved data.
      * Again you have to apply for the call of this method in the Restore() call:
@@ -146,6 +159,17 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** Offers to restore a file only when its data is first needed
+     * If the reader restores lazily, it calls this method instead of
+     * RestoreDocFile(). An implementation that returns true keeps \a file,
+     * sets a loader on it and calls LazyDocFile::load() before it accesses
+     * the data. The default implementation returns false, in which case
+     * RestoreDocFile() is called right away.
+     */
+    virtual bool restoreDocFileLazily(const std::shared_ptr<LazyDocFile>& /*file*/)
+    {
+        return false;
+    }
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
     /// Replaces all characters with '_' that are not allowed in XML
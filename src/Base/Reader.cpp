@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <iostream>
@@ -46,6 +47,7 @@
 #ifdef _MSC_VER
 # include <zipios++/zipios-config.h>
 #endif
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -110,6 +112,23 @@ unsigned int Base::XMLReader::getAttributeCount() const
 
 namespace
 {
+void appendStartTag(std::string& out,
+                    const std::string& name,
+                    const std::map<std::string, std::string>& attrs,
+                    bool empty)
+{
+    out += '<';
+    out += name;
+    for (const auto& [key, value] : attrs) {
+        out += ' ';
+        out += key;
+        out += "=\"";
+        out += Base::Persistence::encodeAttribute(value);
+        out += '"';
+    }
+    out += empty ? "/>" : ">";
+}
+
 template<typename T>
 T readerCast(const char* value)
 {
@@ -416,6 +435,25 @@ std::istream& Base::XMLReader::beginCharStream(CharStreamFormat format)
     return *CharStream;
 }
 
+void Base::XMLReader::beginCapture()
+{
+    if (ReadType != StartElement && ReadType != StartEndElement) {
+        throw Base::XMLParseException("invalid state while capturing an element");
+    }
+
+    Capture.clear();
+    appendStartTag(Capture, LocalName, AttrMap, ReadType == StartEndElement);
+    Capturing = ReadType == StartElement;
+}
+
+std::string Base::XMLReader::endCapture()
+{
+    Capturing = false;
+    std::string xml;
+    xml.swap(Capture);
+    return xml;
+}
+
 void Base::XMLReader::readBinFile(const char* filename)
 {
     Base::FileInfo fi(filename);
@@ -468,10 +506,18 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // no file name for the current entry in the zip was registered.
         if (jt != FileList.end()) {
             try {
-                Base::Reader reader(zipstream, jt->FileName, FileVersion);
-                jt->Object->RestoreDocFile(reader);
-                if (reader.getLocalReader()) {
-                    reader.getLocalReader()->readFiles(zipstream);
+                auto lazyFile = LazyArchive
+                    ? std::make_shared<LazyDocFile>(LazyArchive, jt->FileName, FileVersion)
+                    : nullptr;
+                if (lazyFile && jt->Object->restoreDocFileLazily(lazyFile)) {
+                    LazyFiles.push_back(lazyFile);
+                }
+                else {
+                    Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                    jt->Object->RestoreDocFile(reader);
+                    if (reader.getLocalReader()) {
+                        reader.getLocalReader()->readFiles(zipstream);
+                    }
                 }
             }
             catch (...) {
@@ -508,6 +554,38 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
     }
 }
 
+void Base::XMLReader::setLazyRestore(bool on)
+{
+    LazyArchive.reset();
+    if (!on) {
+        return;
+    }
+
+    try {
+        auto archive = std::make_shared<zipios::ZipFile>(_File.filePath());
+        if (archive->isValid()) {
+            LazyArchive = archive;
+        }
+    }
+    catch (const std::exception& e) {
+        Base::Console().warning(
+            "Cannot restore '%s' lazily: %s\n",
+            _File.filePath().c_str(),
+            e.what()
+        );
+    }
+}
+
+bool Base::XMLReader::isLazyRestore() const
+{
+    return LazyArchive != nullptr;
+}
+
+std::vector<std::weak_ptr<Base::LazyDocFile>> Base::XMLReader::getLazyFiles() const
+{
+    return LazyFiles;
+}
+
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
 {
     FileEntry temp;
@@ -524,6 +602,16 @@ bool Base::XMLReader::hasFilenames() const
     return !FileList.empty();
 }
 
+std::vector<std::pair<std::string, Base::Persistence*>> Base::XMLReader::getFiles() const
+{
+    std::vector<std::pair<std::string, Base::Persistence*>> files;
+    files.reserve(FileList.size());
+    for (const auto& entry : FileList) {
+        files.emplace_back(entry.FileName, entry.Object);
+    }
+    return files;
+}
+
 bool Base::XMLReader::hasReadFailed(const std::string& filename) const
 {
     return std::ranges::find(FailedFiles, filename) != FailedFiles.end();
@@ -583,6 +671,9 @@ void Base::XMLReader::startElement(
     for (unsigned int i = 0; i < attrs.getLength(); i++) {
         AttrMap[StrX(attrs.getQName(i)).c_str()] = StrXUTF8(attrs.getValue(i)).c_str();
     }
+    if (Capturing) {
+        appendStartTag(Capture, LocalName, AttrMap, false);
+    }
 
     ReadType = StartElement;
 }
@@ -591,6 +682,9 @@ void Base::XMLReader::endElement(const XMLCh* const /*uri*/, const XMLCh* const
 {
     Level--;  // end of scope
     LocalName = StrX(localname).c_str();
+    if (Capturing) {
+        Capture += "</" + LocalName + ">";
+    }
 
     if (ReadType == StartElement) {
         ReadType = StartEndElement;
@@ -603,11 +697,19 @@ void Base::XMLReader::endElement(const XMLCh* const /*uri*/, const XMLCh* const
 void Base::XMLReader::startCDATA()
 {
     ReadType = StartCDATA;
+    InCDATA = true;
+    if (Capturing) {
+        Capture += "<![CDATA[";
+    }
 }
 
 void Base::XMLReader::endCDATA()
 {
     ReadType = EndCDATA;
+    InCDATA = false;
+    if (Capturing) {
+        Capture += "]]>";
+    }
 }
 
 void Base::XMLReader::characters(const XMLCh* const chars, const XMLSize_t length)
@@ -615,6 +717,10 @@ void Base::XMLReader::characters(const XMLCh* const chars, const XMLSize_t lengt
     Characters = StrX(chars).c_str();
     ReadType = Chars;
     CharacterCount += length;
+    if (Capturing) {
+        std::string text = StrXUTF8(chars).str;
+        Capture += InCDATA ? text : Base::Persistence::encodeAttribute(text);
+    }
 }
 
 void Base::XMLReader::ignorableWhitespace(const XMLCh* const /*chars*/, const XMLSize_t /*length*/)
@@ -734,3 +840,102 @@ std::shared_ptr<Base::XMLReader> Base::Reader::getLocalReader() const
 {
     return (this->localreader);
 }
+
+// ----------------------------------------------------------------------------
+
+Base::LazyDocFile::LazyDocFile(
+    std::shared_ptr<zipios::ZipFile> archive,
+    std::string fileName,
+    int version
+)
+    : archive(std::move(archive))
+    , fileName(std::move(fileName))
+    , fileVersion(version)
+{}
+
+bool Base::LazyDocFile::addLoader(const void* owner, Loader func)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (loaded.load(std::memory_order_relaxed) || loading) {
+        return false;
+    }
+    removeLoader(owner);
+    loaders.emplace_back(owner, std::move(func));
+    return true;
+}
+
+void Base::LazyDocFile::removeLoader(const void* owner)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = std::find_if(loaders.begin(), loaders.end(), [owner](const auto& entry) {
+        return entry.first == owner;
+    });
+    if (it != loaders.end()) {
+        loaders.erase(it);
+    }
+}
+
+void Base::LazyDocFile::load()
+{
+    if (loaded.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    // The loader accessing the data on this thread must not load it again,
+    // other threads wait on the mutex until the data is complete
+    if (loaded.load(std::memory_order_relaxed) || loading) {
+        return;
+    }
+
+    loading = true;
+    auto funcs = std::move(loaders);
+    loaders.clear();
+    for (const auto& entry : funcs) {
+        try {
+            std::unique_ptr<std::istream> str(archive->getInputStream(fileName));
+            if (!str) {
+                throw Base::FileException("Embedded file not found in archive", fileName);
+            }
+            Base::Reader reader(*str, fileName, fileVersion);
+            entry.second(reader);
+        }
+        catch (...) {
+            // Same as in XMLReader::readFiles() the failure is only reported
+            Base::Console().error("Reading failed from embedded file: %s\n", fileName.c_str());
+        }
+    }
+    loading = false;
+    // Published only now, so that other threads never see partially read data
+    loaded.store(true, std::memory_order_release);
+}
+
+bool Base::LazyDocFile::isLoaded() const
+{
+    return loaded.load(std::memory_order_acquire);
+}
+
+const std::string& Base::LazyDocFile::getFileName() const
+{
+    return fileName;
+}
+
+std::size_t Base::LazyDocFile::getSize() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto entry = archive->getEntry(fileName);
+    return entry ? static_cast<std::size_t>(entry->getSize()) : 0;
+}
+
+std::string Base::LazyDocFile::getArchiveName() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return archive->getName();
+}
+
+void Base::LazyDocFile::relocate(std::shared_ptr<zipios::ZipFile> archive, std::string fileName)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    this->archive = std::move(archive);
+    this->fileName = std::move(fileName);
+}
@@ -24,9 +24,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <bitset>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -40,6 +43,7 @@
 
 namespace zipios
 {
+class ZipFile;
 class ZipInputStream;
 }
 
@@ -52,6 +56,7 @@ class SAX2XMLReader;
 
 namespace Base
 {
+class LazyDocFile;
 class Persistence;
 
 /** The XML reader class
@@ -209,6 +214,16 @@ public:
     std::istream& charStream();
     //@}
 
+    //@{
+    /** Record the current element and everything read until endCapture() as XML text.
+     * The reader must be positioned on a start element. The recorded text is a well
+     * formed document that can be read by another XMLReader, e.g. in a worker thread.
+     */
+    void beginCapture();
+    /// Stop recording and return the recorded XML text
+    std::string endCapture();
+    //@}
+
     /// read binary file
     void readBinFile(const char*);
     //@}
@@ -277,8 +292,21 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Postpone reading files to the objects that support it
+     * If enabled readFiles() offers every file to its object via
+     * Persistence::restoreDocFileLazily() first and skips the ones taken.
+     * The files are read again from the archive this reader was created
+     * for, so this must only be enabled if it is a real file that stays
+     * in place.
+     */
+    void setLazyRestore(bool on);
+    bool isLazyRestore() const;
+    /// Returns the files whose restore has been postponed by readFiles()
+    std::vector<std::weak_ptr<LazyDocFile>> getLazyFiles() const;
     /// Returns whether reader has any registered filenames
     bool hasFilenames() const;
+    /// Returns the registered files together with the objects reading them
+    std::vector<std::pair<std::string, Base::Persistence*>> getFiles() const;
     /// returns true if reading the file \a filename has failed
     bool hasReadFailed(const std::string& filename) const;
     bool isRegistered(Base::Persistence* Object) const;
@@ -361,6 +389,10 @@ private:
     std::map<std::string, std::string> AttrMap;
     using AttrMapType = std::map<std::string, std::string>;
 
+    std::string Capture;
+    bool Capturing {false};
+    bool InCDATA {false};
+
     enum
     {
         None = 0,
@@ -391,6 +423,8 @@ public:
 
 private:
     mutable std::vector<std::string> FailedFiles;
+    std::shared_ptr<zipios::ZipFile> LazyArchive;
+    mutable std::vector<std::weak_ptr<LazyDocFile>> LazyFiles;
 
     std::bitset<32> StatusBits;
 
@@ -414,4 +448,47 @@ private:
     std::shared_ptr<Base::XMLReader> localreader;
 };
 
+/** A file of a project archive whose restore has been postponed
+ * The XMLReader hands it to the objects that want to read their data on
+ * first use, see Persistence::restoreDocFileLazily(). The object adds a
+ * loader that gets called with a reader for the file on the first load().
+ * Copies of the object may add their own loader to share the postponed data.
+ * Loading is thread safe, concurrent callers wait until the data is read.
+ */
+class BaseExport LazyDocFile
+{
+public:
+    using Loader = std::function<void(Reader&)>;
+
+    LazyDocFile(std::shared_ptr<zipios::ZipFile> archive, std::string fileName, int version);
+
+    /** Add the function that restores the data of \a owner from the file
+     * Returns false if the file has already been loaded, the owner must then
+     * get the data from elsewhere.
+     */
+    bool addLoader(const void* owner, Loader func);
+    /// Remove the loader of \a owner, e.g. because it got a new value
+    void removeLoader(const void* owner);
+    /// Read the file if this has not happened yet
+    void load();
+    bool isLoaded() const;
+    const std::string& getFileName() const;
+    /// Return the uncompressed size of the file without reading it
+    std::size_t getSize() const;
+    /// Return the path of the archive the file is read from
+    std::string getArchiveName() const;
+    /// Read the file from now on as \a fileName of \a archive, which must hold the same data
+    void relocate(std::shared_ptr<zipios::ZipFile> archive, std::string fileName);
+
+private:
+    std::shared_ptr<zipios::ZipFile> archive;
+    std::string fileName;
+    int fileVersion;
+    std::vector<std::pair<const void*, Loader>> loaders;
+    mutable std::recursive_mutex mutex;
+    /// set while the loader runs, guarded by the mutex
+    bool loading {false};
+    std::atomic<bool> loaded {false};
+};
+
 }  // namespace Base
@@ -0,0 +1,343 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2026 The FreeCAD project association AISBL
+// SPDX-FileNotice: Part of the FreeCAD project.
+
+/******************************************************************************
+ *                                                                            *
+ *   FreeCAD is free software: you can redistribute it and/or modify          *
+ *   it under the terms of the GNU Lesser General Public License as           *
+ *   published by the Free Software Foundation, either version 2.1            *
+ *   of the License, or (at your option) any later version.                   *
+ *                                                                            *
+ *   FreeCAD is distributed in the hope that it will be useful,               *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty              *
+ *   of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.                  *
+ *   See the GNU Lesser General Public License for more details.              *
+ *                                                                            *
+ *   You should have received a copy of the GNU Lesser General Public         *
+ *   License along with FreeCAD. If not, see https://www.gnu.org/licenses     *
+ *                                                                            *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Base
+{
+
+/**
+ * @brief An implicitly shared vector with copy-on-write semantics.
+ *
+ * Copying a SharedVector only copies a reference to its buffer. The buffer is
+ * copied the first time a non-const member is called on an instance that
+ * shares it with another one, so copies are cheap until they are modified.
+ *
+ * The const interface mirrors std::vector, and a SharedVector converts to a
+ * const reference of the underlying std::vector. Like with Qt's implicitly
+ * shared containers, iterators and references obtained from a non-const
+ * instance are invalidated when the instance is copied afterwards.
+ */
+template<typename T>
+class SharedVector
+{
+public:
+    using vector_type = std::vector<T>;
+    using value_type = typename vector_type::value_type;
+    using size_type = typename vector_type::size_type;
+    using reference = typename vector_type::reference;
+    using const_reference = typename vector_type::const_reference;
+    using iterator = typename vector_type::iterator;
+    using const_iterator = typename vector_type::const_iterator;
+
+    SharedVector() = default;
+    SharedVector(const SharedVector&) = default;
+    SharedVector(SharedVector&&) noexcept = default;
+    SharedVector& operator=(const SharedVector&) = default;
+    SharedVector& operator=(SharedVector&&) noexcept = default;
+    ~SharedVector() = default;
+
+    SharedVector(const vector_type& values)  // NOLINT
+    {
+        assign(values);
+    }
+    SharedVector(vector_type&& values)  // NOLINT
+    {
+        assign(std::move(values));
+    }
+    SharedVector(std::initializer_list<T> values)
+    {
+        assign(vector_type(values));
+    }
+
+    SharedVector& operator=(const vector_type& values)
+    {
+        assign(values);
+        return *this;
+    }
+    SharedVector& operator=(vector_type&& values)
+    {
+        assign(std::move(values));
+        return *this;
+    }
+
+    /// Access the values without detaching.
+    const vector_type& values() const
+    {
+        return d ? *d : empty_vector();
+    }
+    operator const vector_type&() const  // NOLINT
+    {
+        return values();
+    }
+
+    /// Returns true if this instance shares its buffer with @p other.
+    bool isSharedWith(const SharedVector& other) const
+    {
+        return d && d == other.d;
+    }
+    /// Returns true if the buffer is referenced by another instance.
+    bool isShared() const
+    {
+        return d && d.use_count() > 1;
+    }
+    /// Returns the number of instances referencing the buffer, at least one.
+    std::size_t useCount() const
+    {
+        return d ? static_cast<std::size_t>(d.use_count()) : 1;
+    }
+
+    size_type size() const
+    {
+        return d ? d->size() : 0;
+    }
+    bool empty() const
+    {
+        return !d || d->empty();
+    }
+    size_type capacity() const
+    {
+        return d ? d->capacity() : 0;
+    }
+
+    const_reference operator[](size_type pos) const
+    {
+        return (*d)[pos];
+    }
+    const_reference at(size_type pos) const
+    {
+        return values().at(pos);
+    }
+    const_reference front() const
+    {
+        return d->front();
+    }
+    const_reference back() const
+    {
+        return d->back();
+    }
+    const T* data() const
+    {
+        return values().data();
+    }
+
+    const_iterator begin() const
+    {
+        return values().begin();
+    }
+    const_iterator end() const
+    {
+        return values().end();
+    }
+    const_iterator cbegin() const
+    {
+        return values().cbegin();
+    }
+    const_iterator cend() const
+    {
+        return values().cend();
+    }
+
+    /// Ensures this instance owns its buffer exclusively and returns it.
+    vector_type& detach()
+    {
+        if (!d) {
+            d = std::make_shared<vector_type>();
+        }
+        else if (d.use_count() > 1) {
+            d = std::make_shared<vector_type>(*d);
+        }
+        return *d;
+    }
+
+    reference operator[](size_type pos)
+    {
+        return detach()[pos];
+    }
+    reference at(size_type pos)
+    {
+        return detach().at(pos);
+    }
+    reference front()
+    {
+        return detach().front();
+    }
+    reference back()
+    {
+        return detach().back();
+    }
+    T* data()
+    {
+        return detach().data();
+    }
+
+    iterator begin()
+    {
+        return detach().begin();
+    }
+    iterator end()
+    {
+        return detach().end();
+    }
+
+    void assign(const vector_type& values)
+    {
+        if (d && d.use_count() == 1) {
+            *d = values;
+        }
+        else {
+            d = std::make_shared<vector_type>(values);
+        }
+    }
+    void assign(vector_type&& values)
+    {
+        if (d && d.use_count() == 1) {
+            *d = std::move(values);
+        }
+        else {
+            d = std::make_shared<vector_type>(std::move(values));
+        }
+    }
+    template<typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        assign(vector_type(first, last));
+    }
+
+    void clear()
+    {
+        // Do not copy a shared buffer just to clear it
+        if (d && d.use_count() > 1) {
+            d.reset();
+        }
+        else if (d) {
+            d->clear();
+        }
+    }
+    void reserve(size_type count)
+    {
+        detach().reserve(count);
+    }
+    void resize(size_type count)
+    {
+        if (count != size()) {
+            detach().resize(count);
+        }
+    }
+    void resize(size_type count, const T& value)
+    {
+        if (count != size()) {
+            detach().resize(count, value);
+        }
+    }
+    void push_back(const T& value)
+    {
+        detach().push_back(value);
+    }
+    void push_back(T&& value)
+    {
+        detach().push_back(std::move(value));
+    }
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        return detach().emplace_back(std::forward<Args>(args)...);
+    }
+    void pop_back()
+    {
+        detach().pop_back();
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        auto index = pos - begin_const();
+        auto& vec = detach();
+        return vec.insert(vec.begin() + index, value);
+    }
+    iterator insert(const_iterator pos, size_type count, const T& value)
+    {
+        auto index = pos - begin_const();
+        auto& vec = detach();
+        return vec.insert(vec.begin() + index, count, value);
+    }
+    template<typename InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        auto index = pos - begin_const();
+        auto& vec = detach();
+        return vec.insert(vec.begin() + index, first, last);
+    }
+    iterator erase(const_iterator pos)
+    {
+        auto index = pos - begin_const();
+        auto& vec = detach();
+        return vec.erase(vec.begin() + index);
+    }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto index = first - begin_const();
+        auto count = last - first;
+        auto& vec = detach();
+        return vec.erase(vec.begin() + index, vec.begin() + index + count);
+    }
+
+    void swap(SharedVector& other) noexcept
+    {
+        d.swap(other.d);
+    }
+    void swap(vector_type& other)
+    {
+        detach().swap(other);
+    }
+
+    friend bool operator==(const SharedVector& lhs, const SharedVector& rhs)
+    {
+        return lhs.d == rhs.d || lhs.values() == rhs.values();
+    }
+    friend bool operator==(const SharedVector& lhs, const vector_type& rhs)
+    {
+        return lhs.values() == rhs;
+    }
+
+private:
+    // Position arithmetic must not detach, as 'pos' may point into the
+    // shared buffer. The index is then applied to the detached copy.
+    const_iterator begin_const() const
+    {
+        return values().begin();
+    }
+
+    static const vector_type& empty_vector()
+    {
+        static const vector_type empty;
+        return empty;
+    }
+
+    std::shared_ptr<vector_type> d;
+};
+
+}  // namespace Base
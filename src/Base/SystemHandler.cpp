@@ -122,6 +122,9 @@ static void printBacktrace([[maybe_unused]] size_t skip = 0)
 
 void segmentation_fault_handler([[maybe_unused]] int sig)
 {
+    // write out what the asynchronous console mode still holds to stderr,
+    // flush() is not async-signal-safe
+    Base::Console().writePendingRaw(2);
 #if defined(FC_OS_LINUX)
     std::cerr << "Program received signal SIGSEGV, Segmentation fault.\n";
     printBacktrace(2);
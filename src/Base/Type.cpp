@@ -22,7 +22,11 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <atomic>
 #include <cassert>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "Interpreter.h"
 #include "Type.h"
@@ -61,7 +65,61 @@ struct Base::TypeData
 namespace
 {
 constexpr const std::string_view BadTypeName = "BadType";
+
+// Preorder number of each type and of the last type in its subtree, so that
+// a type is derived from another one if its number lies in the other's range.
+struct TypeInterval
+{
+    Type::TypeId first;
+    Type::TypeId last;
+};
+
+using TypeIntervals = std::vector<TypeInterval>;
+
+// The published table is immutable and read without locking. A table that
+// gets replaced after registering further types is kept alive until
+// destruct(), because readers may still use it. Modules register their types
+// in one go when they are loaded, so usually a table is retired once per
+// module loaded after the first lookup, taking 8 bytes per type known then.
+std::atomic<const TypeIntervals*> typeIntervals {nullptr};
+std::vector<std::unique_ptr<const TypeIntervals>> typeIntervalTables;
+std::mutex typeIntervalsMutex;
+
+const TypeIntervals& buildTypeIntervals(const std::vector<TypeData*>& typedata)
+{
+    std::lock_guard<std::mutex> lock(typeIntervalsMutex);
+    // createType() appends under the same mutex, so the size is current
+    const auto* current = typeIntervals.load(std::memory_order_acquire);
+    if (current && current->size() == typedata.size()) {
+        return *current;
+    }
+
+    // A parent is always registered before its derived types
+    const auto count = static_cast<Type::TypeId>(typedata.size());
+    std::vector<Type::TypeId> size(count, 1);
+    for (Type::TypeId i = count; i-- > 1;) {
+        if (auto parent = typedata[i]->parent.getKey(); parent != 0) {
+            size[parent] += size[i];
+        }
+    }
+
+    // The bad type only contains itself, all root types follow it
+    std::vector<Type::TypeId> next(count, 0);
+    auto table = std::make_unique<TypeIntervals>(count, TypeInterval {0, 0});
+    auto& intervals = *table;
+    Type::TypeId nextRoot = 1;
+    for (Type::TypeId i = 1; i < count; ++i) {
+        auto parent = typedata[i]->parent.getKey();
+        auto& first = parent != 0 ? next[parent] : nextRoot;
+        intervals[i] = {first, first + size[i] - 1};
+        first += size[i];
+        next[i] = intervals[i].first + 1;
+    }
+    typeIntervals.store(table.get(), std::memory_order_release);
+    typeIntervalTables.push_back(std::move(table));
+    return intervals;
 }
+}  // namespace
 
 std::map<std::string, unsigned int, std::less<>> Type::typemap;
 std::vector<TypeData*> Type::typedata;
@@ -139,6 +197,9 @@ const Type Type::createType(const Type parent, std::string_view name, instantiat
 {
     assert(!name.empty() && "Type name must not be empty");
 
+    // a table built meanwhile must not miss the new type
+    std::lock_guard<std::mutex> lock(typeIntervalsMutex);
+
     Type newType;
     newType.index = static_cast<unsigned int>(Type::typedata.size());
     Type::typedata.emplace_back(new TypeData(name, newType, parent, method));
@@ -146,6 +207,8 @@ const Type Type::createType(const Type parent, std::string_view name, instantiat
     // add to dictionary for fast lookup
     Type::typemap.emplace(name, newType.getKey());
 
+    typeIntervals.store(nullptr, std::memory_order_release);
+
     return newType;
 }
 
@@ -155,6 +218,7 @@ void Type::init()
     assert(Type::typedata.empty() && "Type::init() should only be called once");
     typedata.emplace_back(new TypeData(BadTypeName, BadType, BadType, nullptr));
     typemap.emplace(BadTypeName, 0);
+    typeIntervals.store(nullptr, std::memory_order_release);
 }
 
 void Type::destruct()
@@ -165,6 +229,9 @@ void Type::destruct()
     typedata.clear();
     typemap.clear();
     loadModuleSet.clear();
+    typeIntervals.store(nullptr, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(typeIntervalsMutex);
+    typeIntervalTables.clear();
 }
 
 Type Type::fromName(std::string_view name)
@@ -204,15 +271,20 @@ Type Type::getParent() const
 
 bool Type::isDerivedFrom(const Type type) const
 {
-    Type temp(*this);
-    do {
-        if (temp == type) {
-            return true;
-        }
-        temp = temp.getParent();
-    } while (!temp.isBad());
+    const auto* table = typeIntervals.load(std::memory_order_acquire);
+    if (!table || index >= table->size() || type.index >= table->size()) {
+        // no table yet or one that was built before registering the types
+        table = &buildTypeIntervals(typedata);
+    }
+    const auto& intervals = *table;
+    assert(index < intervals.size() && type.index < intervals.size() && "Type index out of bounds");
+    if (index >= intervals.size() || type.index >= intervals.size()) {
+        return false;
+    }
 
-    return false;
+    const auto number = intervals[index].first;
+    const auto& range = intervals[type.index];
+    return range.first <= number && number <= range.last;
 }
 
 int Type::getAllDerivedFrom(const Type type, std::vector<Type>& list)
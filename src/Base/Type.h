@@ -107,7 +107,7 @@ public:
     [[nodiscard]] std::string_view getName() const;
     /// Returns the parent type
     [[nodiscard]] Type getParent() const;
-    /// Checks whether this type is derived from "type"
+    /// Checks whether this type is derived from "type", in constant time
     [[nodiscard]] bool isDerivedFrom(const Type type) const;
     /// Returns all descendants from the given type
     static int getAllDerivedFrom(const Type type, std::vector<Type>& list);
@@ -23,6 +23,8 @@
  ***************************************************************************/
 
 
+#include <deque>
+#include <future>
 #include <memory>
 #include <set>
 #include <vector>
@@ -42,7 +44,9 @@
 #include "Tools.h"
 
 #include <boost/iostreams/filtering_stream.hpp>
+#include <zipios++/zipfile.h>
 #include <zipios++/zipinputstream.h>
+#include <zlib.h>
 
 using namespace Base;
 
@@ -81,6 +85,137 @@ struct cdata_filter
     int state = 0;
 };
 
+namespace
+{
+
+void setupStream(std::ostream& str)
+{
+    str.imbue(std::locale::classic());
+    str.precision(std::numeric_limits<double>::digits10 + 1);
+    str.setf(std::ios::fixed, std::ios::floatfield);
+}
+
+// Writer used by ZipWriter to serialize a single file on a worker thread
+class EntryWriter: public Writer
+{
+public:
+    EntryWriter(const Writer& owner, const std::string& fileName)
+    {
+        setModes(owner.getModes());
+        setForceXML(owner.isForceXML());
+        setFileVersion(owner.getFileVersion());
+        Writer::putNextEntry(fileName.c_str());
+        setupStream(StrStream);
+    }
+
+    std::ostream& Stream() override
+    {
+        return StrStream;
+    }
+    const std::ostream& Stream() const override
+    {
+        return StrStream;
+    }
+    std::string getString() const
+    {
+        return StrStream.str();
+    }
+    bool hasAddedFiles() const
+    {
+        return !FileList.empty();
+    }
+    void writeFiles() override
+    {}
+
+private:
+    std::ostringstream StrStream;
+};
+
+struct CompressedEntry
+{
+    std::string fileName;
+    std::string data;
+    uint32_t size {0};
+    uint32_t crc {0};
+    zipios::StorageMethod method {zipios::DEFLATED};
+    std::vector<std::string> errors;
+};
+
+CompressedEntry compressEntry(const std::string& fileName, const std::string& content, int level)
+{
+    if (content.size() > std::numeric_limits<uint32_t>::max()) {
+        throw Base::FileException("ZipWriter: file exceeds the zip size limit", fileName);
+    }
+
+    CompressedEntry entry;
+    entry.fileName = fileName;
+    entry.size = static_cast<uint32_t>(content.size());
+
+    // NOLINTBEGIN
+    auto input = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+    entry.crc = static_cast<uint32_t>(crc32(0, input, entry.size));
+
+    // Negative window bits write raw deflate data without zlib header, the
+    // same as zipios does for entries written through the stream
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("ZipWriter: failed to initialize compression");
+    }
+    entry.data.resize(deflateBound(&zs, entry.size));
+    zs.next_in = input;
+    zs.avail_in = entry.size;
+    zs.next_out = reinterpret_cast<Bytef*>(entry.data.data());
+    zs.avail_out = static_cast<uInt>(entry.data.size());
+    int err = deflate(&zs, Z_FINISH);
+    deflateEnd(&zs);
+    // NOLINTEND
+    if (err != Z_STREAM_END) {
+        throw Base::FileException("ZipWriter: failed to compress file", fileName);
+    }
+    entry.data.resize(zs.total_out);
+    return entry;
+}
+
+// Reads the stored data of an object's file in the previous archive
+bool readPreviousEntry(
+    zipios::ZipFile* archive,
+    const std::map<const Base::Persistence*, std::string>& files,
+    const std::string& fileName,
+    const Base::Persistence* object,
+    CompressedEntry& entry
+)
+{
+    if (!archive) {
+        return false;
+    }
+    auto it = files.find(object);
+    if (it == files.end()) {
+        return false;
+    }
+    // The unique suffix of the name may differ, but the extension tells the
+    // format of the data and must be the same
+    if (Base::FileInfo(it->second).extension() != Base::FileInfo(fileName).extension()) {
+        return false;
+    }
+
+    try {
+        zipios::ConstEntryPointer stored = archive->getRawData(it->second, entry.data);
+        if (!stored) {
+            return false;
+        }
+        entry.fileName = fileName;
+        entry.size = stored->getSize();
+        entry.crc = stored->getCrc();
+        entry.method = stored->getMethod();
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+}  // namespace
+
 // ---------------------------------------------------------------------------
 //  Writer: Constructors and Destructor
 // ---------------------------------------------------------------------------
@@ -311,6 +446,16 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
     return temp.FileName;
 }
 
+std::vector<std::pair<std::string, const Base::Persistence*>> Writer::getFiles() const
+{
+    std::vector<std::pair<std::string, const Base::Persistence*>> files;
+    files.reserve(FileList.size());
+    for (const auto& entry : FileList) {
+        files.emplace_back(entry.FileName, entry.Object);
+    }
+    return files;
+}
+
 void Writer::incInd()
 {
     if (indent < 1020) {
@@ -344,17 +489,15 @@ void Writer::putNextEntry(const char* file, const char* obj)
 ZipWriter::ZipWriter(const char* FileName)
     : ZipStream(FileName)
 {
-    ZipStream.imbue(std::locale::classic());
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    setupStream(ZipStream);
+    setupStream(EntryStream);
 }
 
 ZipWriter::ZipWriter(std::ostream& os)
     : ZipStream(os)
 {
-    ZipStream.imbue(std::locale::classic());
-    ZipStream.precision(std::numeric_limits<double>::digits10 + 1);
-    ZipStream.setf(std::ios::fixed, std::ios::floatfield);
+    setupStream(ZipStream);
+    setupStream(EntryStream);
 }
 
 void ZipWriter::putNextEntry(const char* file, const char* obj)
@@ -366,18 +509,124 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     Writer::checkErrNo();
 }
 
+void ZipWriter::setPreviousFiles(
+    std::shared_ptr<zipios::ZipFile> archive,
+    std::map<const Base::Persistence*, std::string> files
+)
+{
+    previousArchive = std::move(archive);
+    previousFiles = std::move(files);
+}
+
 void ZipWriter::writeFiles()
 {
+    if (threadCount > 1) {
+        writeFilesConcurrently();
+        return;
+    }
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        putNextEntry(entry.FileName.c_str());
-        indent = 0;
-        indBuf[0] = 0;
-        entry.Object->SaveDocFile(*this);
+        CompressedEntry previous;
+        if (readPreviousEntry(previousArchive.get(), previousFiles, entry.FileName, entry.Object, previous)) {
+            ZipStream.putRawEntry(
+                zipios::ZipCDirEntry(previous.fileName),
+                previous.data.data(),
+                static_cast<uint32_t>(previous.data.size()),
+                previous.size,
+                previous.crc,
+                previous.method
+            );
+            checkErrNo();
+            copiedFiles.emplace(previousFiles.at(entry.Object), entry.FileName);
+        }
+        else {
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+        }
+        index++;
+    }
+}
+
+void ZipWriter::writeFilesConcurrently()
+{
+    // Entries are compressed in the background but written in the order of
+    // FileList, so the archive looks the same as with a single thread
+    std::deque<std::future<CompressedEntry>> pending;
+    auto writeNext = [this, &pending]() {
+        CompressedEntry done = pending.front().get();
+        pending.pop_front();
+        for (const auto& msg : done.errors) {
+            addError(msg);
+        }
+        ZipStream.putRawEntry(
+            zipios::ZipCDirEntry(done.fileName),
+            done.data.data(),
+            static_cast<uint32_t>(done.data.size()),
+            done.size,
+            done.crc,
+            done.method
+        );
+        checkErrNo();
+    };
+
+    const int level = compressionLevel;
+    // use a while loop because it is possible that while
+    // processing the files new ones can be added
+    size_t index = 0;
+    while (index < FileList.size()) {
+        FileEntry entry = FileList[index];
+        CompressedEntry previous;
+        if (readPreviousEntry(previousArchive.get(), previousFiles, entry.FileName, entry.Object, previous)) {
+            // already compressed, just keep its place in the order
+            std::promise<CompressedEntry> ready;
+            ready.set_value(std::move(previous));
+            pending.push_back(ready.get_future());
+            copiedFiles.emplace(previousFiles.at(entry.Object), entry.FileName);
+        }
+        else if (entry.Object->canSaveDocFileConcurrently()) {
+            auto task = [entry, level, writer = std::make_unique<EntryWriter>(*this, entry.FileName)]() {
+                entry.Object->SaveDocFile(*writer);
+                CompressedEntry result = compressEntry(entry.FileName, writer->getString(), level);
+                result.errors = writer->getErrors();
+                if (writer->hasAddedFiles()) {
+                    result.errors.push_back(entry.FileName + ": cannot add files while saving concurrently");
+                }
+                return result;
+            };
+            pending.push_back(std::async(std::launch::async, std::move(task)));
+        }
+        else {
+            // Serialize on this thread, where the object may still add
+            // further files, and only hand the compression off
+            Writer::putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            EntryStream.str(std::string());
+            EntryStream.clear();
+            {
+                Base::StateLocker lock(bufferEntry);
+                entry.Object->SaveDocFile(*this);
+            }
+            pending.push_back(
+                std::async(std::launch::async, compressEntry, entry.FileName, EntryStream.str(), level)
+            );
+        }
         index++;
+
+        // limit the number of serialized files held in memory
+        while (pending.size() > threadCount) {
+            writeNext();
+        }
+    }
+
+    while (!pending.empty()) {
+        writeNext();
     }
 }
 
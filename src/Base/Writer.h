@@ -25,9 +25,11 @@
 #pragma once
 
 
+#include <map>
 #include <set>
 #include <string>
 #include <sstream>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -38,6 +40,11 @@
 #include "FileInfo.h"
 
 
+namespace zipios
+{
+class ZipFile;
+}
+
 namespace Base
 {
 
@@ -97,6 +104,8 @@ public:
     //@{
     /// add a write request of a persistent object
     std::string addFile(const char* Name, const Base::Persistence* Object);
+    /// Returns the requested files together with the objects writing them
+    std::vector<std::pair<std::string, const Base::Persistence*>> getFiles() const;
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// Set mode
@@ -226,11 +235,17 @@ public:
 
     std::ostream& Stream() override
     {
+        if (bufferEntry) {
+            return EntryStream;
+        }
         return ZipStream;
     }
 
     const std::ostream& Stream() const override
     {
+        if (bufferEntry) {
+            return EntryStream;
+        }
         return ZipStream;
     }
 
@@ -240,8 +255,47 @@ public:
     }
     void setLevel(int level)
     {
+        compressionLevel = level;
         ZipStream.setLevel(level);
     }
+    /** Set the number of threads used by writeFiles()
+     * With more than one thread every additional file is first serialized
+     * into memory and then deflated on a worker thread. The finished entries
+     * are written to the archive in the order the files were added, so the
+     * result does not depend on the thread count. Objects that return true
+     * from Persistence::canSaveDocFileConcurrently() are serialized on the
+     * worker thread, too, all others still on the calling thread.
+     */
+    void setThreadCount(unsigned int count)
+    {
+        threadCount = count;
+    }
+    unsigned int getThreadCount() const
+    {
+        return threadCount;
+    }
+    /** Copy unchanged files from a previously written archive
+     * For the objects in \a files, which maps an object to the name of its
+     * file in \a archive, writeFiles() copies the stored entry verbatim
+     * instead of calling SaveDocFile() and compressing the output again.
+     * The caller must make sure that these objects have not changed since
+     * the archive was written. Objects whose entry cannot be found are
+     * written as usual.
+     */
+    void setPreviousFiles(
+        std::shared_ptr<zipios::ZipFile> archive,
+        std::map<const Base::Persistence*, std::string> files
+    );
+    /// Returns the number of files copied from the previous archive
+    std::size_t getCopiedFileCount() const
+    {
+        return copiedFiles.size();
+    }
+    /// Returns the copied files, mapping their name in the previous archive to the new one
+    const std::map<std::string, std::string>& getCopiedFiles() const
+    {
+        return copiedFiles;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
     ZipWriter(const ZipWriter&) = delete;
@@ -250,7 +304,16 @@ public:
     ZipWriter& operator=(ZipWriter&&) = delete;
 
 private:
+    void writeFilesConcurrently();
+
     zipios::ZipOutputStream ZipStream;
+    std::shared_ptr<zipios::ZipFile> previousArchive;
+    std::map<const Base::Persistence*, std::string> previousFiles;
+    std::map<std::string, std::string> copiedFiles;
+    std::ostringstream EntryStream;
+    bool bufferEntry {false};
+    int compressionLevel {6};
+    unsigned int threadCount {1};
 };
 
 /** The StringWriter class
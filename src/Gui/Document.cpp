@@ -20,12 +20,16 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <tuple>
 #include <memory>
 #include <list>
 #include <string>
 #include <map>
 #include <set>
+#include <sstream>
 #include <unordered_map>
 #include <vector>
 #include <cctype>
@@ -44,6 +48,7 @@
 #include <App/Document.h>
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
+#include <App/PropertyPythonObject.h>
 #include <App/Transactions.h>
 #include <App/ElementNamingUtils.h>
 #include <Base/Console.h>
@@ -135,6 +140,7 @@ struct DocumentP
     Connection connectFinishRestoreObject;
     Connection connectExportObjects;
     Connection connectImportObjects;
+    Connection connectCopyObjects;
     Connection connectFinishImportObjects;
     Connection connectUndoDocument;
     Connection connectRedoDocument;
@@ -531,6 +537,9 @@ Document::Document(App::Document* pcDocument, Application* app)
     d->connectImportObjects = pcDocument->signalImportViewObjects.connect(
         std::bind(&Gui::Document::importObjects, this, sp::_1, sp::_2, sp::_3)
     );
+    d->connectCopyObjects = pcDocument->signalCopyViewObjects.connect(
+        std::bind(&Gui::Document::copyViewObjects, this, sp::_1, sp::_2)
+    );
     d->connectFinishImportObjects = pcDocument->signalFinishImportObjects.connect(
         std::bind(&Gui::Document::slotFinishImportObjects, this, sp::_1)
     );
@@ -570,6 +579,13 @@ Document::Document(App::Document* pcDocument, Application* app)
     );
 
     d->_pcDocument->setMaxUndoStackSize(hGrp->GetInt("MaxUndoSize", 20));
+    // undo memory budget in MB, 0 for no limit
+    std::uint64_t maxUndoMemory = hGrp->GetUnsigned("MaxUndoMemory", 0);
+    maxUndoMemory = std::min<std::uint64_t>(
+        maxUndoMemory * 1024U * 1024U,
+        std::numeric_limits<unsigned int>::max()
+    );
+    d->_pcDocument->setUndoLimit(static_cast<unsigned int>(maxUndoMemory));
     d->_changeViewTouchDocument = hGrp->GetBool("ChangeViewProviderTouchDocument", true);
 }
 
@@ -590,6 +606,7 @@ Document::~Document()
     d->connectFinishRestoreObject.disconnect();
     d->connectExportObjects.disconnect();
     d->connectImportObjects.disconnect();
+    d->connectCopyObjects.disconnect();
     d->connectFinishImportObjects.disconnect();
     d->connectUndoDocument.disconnect();
     d->connectRedoDocument.disconnect();
@@ -2302,6 +2319,79 @@ void Document::importObjects(
     }
 }
 
+void Document::copyViewObjects(
+    const std::vector<App::DocumentObject*>& objs,
+    const std::vector<App::DocumentObject*>& copies
+)
+{
+    // Same as importObjects(), the copies are finished by signalFinishRestoreObject
+    for (std::size_t i = 0; i < objs.size() && i < copies.size(); ++i) {
+        Document* doc = Application::Instance->getDocument(objs[i]->getDocument());
+        ViewProvider* from = doc ? doc->getViewProvider(objs[i]) : nullptr;
+        ViewProvider* to = getViewProvider(copies[i]);
+        if (!from || !to) {
+            continue;
+        }
+        to->setStatus(Gui::isRestoring, true);
+        auto vpd = freecad_cast<ViewProviderDocumentObject*>(to);
+        if (vpd) {
+            vpd->startRestoring();
+        }
+
+        std::map<std::string, App::Property*> props;
+        from->getPropertyMap(props);
+        for (const auto& [name, prop] : props) {
+            if (prop->testStatus(App::Property::PropNoPersist)
+                || prop->testStatus(App::Property::Transient)
+                || prop->testStatus(App::Property::PropTransient)
+                || (prop->getType() & App::Prop_Transient) != 0) {
+                continue;
+            }
+            try {
+                auto target = to->getPropertyByName(name.c_str());
+                if (!target || target->getContainer() != to) {
+                    if (!prop->testStatus(App::Property::PropDynamic)) {
+                        continue;
+                    }
+                    auto data = from->getDynamicPropertyData(prop);
+                    target = to->addDynamicProperty(
+                        prop->getTypeId().getName(),
+                        name.c_str(),
+                        data.group.c_str(),
+                        data.doc.c_str(),
+                        data.attr,
+                        data.readonly,
+                        data.hidden
+                    );
+                }
+                if (!target || target->getTypeId() != prop->getTypeId()) {
+                    continue;
+                }
+                target->setStatusValue(prop->getStatus());
+                if (prop->isDerivedFrom<App::PropertyPythonObject>()) {
+                    // Paste() would share the Python object with the source
+                    Base::StringWriter writer;
+                    prop->Save(writer);
+                    std::istringstream str(writer.getString());
+                    Base::XMLReader reader("GuiDocument.xml", str);
+                    target->Restore(reader);
+                }
+                else {
+                    std::unique_ptr<App::Property> value(prop->Copy());
+                    target->Paste(*value);
+                }
+            }
+            catch (const Base::Exception& e) {
+                e.reportException();
+            }
+        }
+
+        if (vpd && objs[i]->testStatus(App::Expand)) {
+            this->signalExpandObject(*vpd, TreeItemMode::ExpandItem, 0, 0);
+        }
+    }
+}
+
 void Document::slotFinishImportObjects(const std::vector<App::DocumentObject*>& objs)
 {
     (void)objs;
@@ -182,6 +182,11 @@ public:
         Base::Reader&,
         const std::map<std::string, std::string>& nameMapping
     );
+    /// Copy the view providers of objects copied in memory to the ones of their copies
+    void copyViewObjects(
+        const std::vector<App::DocumentObject*>& objs,
+        const std::vector<App::DocumentObject*>& copies
+    );
     /// Add all root objects of the given array to a group
     void addRootObjectsToGroup(const std::vector<App::DocumentObject*>&, App::DocumentObjectGroup*);
     //@}
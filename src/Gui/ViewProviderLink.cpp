@@ -2615,6 +2615,10 @@ std::vector<App::DocumentObject*> ViewProviderLink::claimChildren() const
                 ret.push_back(obj);
             }
         }
+        // Element objects created on demand
+        for (const auto& [index, obj] : ext->getElementObjects()) {
+            ret.push_back(obj);
+        }
     }
     else if (hasElements(ext) || isGroup(ext)) {
         ret = ext->getElementListValue();
@@ -152,6 +152,13 @@ int main(int argc, char** argv)
         exit(1);
     }
 
+    // A batch run reports failed documents through the exit code
+    int exitCode = 0;
+    const auto& config = Application::Config();
+    if (auto it = config.find("BatchFailed"); it != config.end() && it->second != "0") {
+        exitCode = 1;
+    }
+
     // Destruction phase ===========================================================
     Console().log("FreeCAD terminating...\n");
 
@@ -167,5 +174,5 @@ int main(int argc, char** argv)
 
     Console().log("FreeCAD completely terminated\n");
 
-    return 0;
+    return exitCode;
 }
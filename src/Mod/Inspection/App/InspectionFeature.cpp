@@ -591,9 +591,10 @@ void PropertyDistanceList::setValues(const std::vector<float>& values)
 
 PyObject* PropertyDistanceList::getPyObject()
 {
+    const std::vector<float>& values = getValues();
     PyObject* list = PyList_New(getSize());
     for (int i = 0; i < getSize(); i++) {
-        PyList_SetItem(list, i, PyFloat_FromDouble(_lValueList[i]));
+        PyList_SetItem(list, i, PyFloat_FromDouble(values[i]));
     }
     return list;
 }
@@ -694,7 +695,8 @@ void PropertyDistanceList::Paste(const App::Property& from)
 
 unsigned int PropertyDistanceList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    // copies share the values until either one is modified
+    return static_cast<unsigned int>(_lValueList.size() * sizeof(float) / _lValueList.useCount());
 }
 
 // ----------------------------------------------------------------
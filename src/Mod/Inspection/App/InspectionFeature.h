@@ -26,6 +26,7 @@
 
 #include <App/DocumentObject.h>
 #include <App/DocumentObjectGroup.h>
+#include <Base/SharedVector.h>
 
 #include <Mod/Inspection/InspectionGlobal.h>
 #include <Mod/Points/App/Points.h>
@@ -232,7 +233,7 @@ public:
     unsigned int getMemSize() const override;
 
 private:
-    std::vector<float> _lValueList;
+    Base::SharedVector<float> _lValueList;
 };
 
 // ----------------------------------------------------------------
@@ -83,10 +83,11 @@ void PropertyNormalList::setValues(const std::vector<Base::Vector3f>& values)
 
 PyObject* PropertyNormalList::getPyObject()
 {
+    const std::vector<Base::Vector3f>& values = getValues();
     PyObject* list = PyList_New(getSize());
 
     for (int i = 0; i < getSize(); i++) {
-        PyList_SetItem(list, i, new Base::VectorPy(_lValueList[i]));
+        PyList_SetItem(list, i, new Base::VectorPy(values[i]));
     }
 
     return list;
@@ -182,7 +183,10 @@ void PropertyNormalList::Paste(const App::Property& from)
 
 unsigned int PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    // copies share the values until either one is modified
+    return static_cast<unsigned int>(
+        _lValueList.size() * sizeof(Base::Vector3f) / _lValueList.useCount()
+    );
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -365,7 +369,7 @@ void PropertyCurvatureList::RestoreDocFile(Base::Reader& reader)
 PyObject* PropertyCurvatureList::getPyObject()
 {
     Py::List list;
-    for (const auto& it : _lValueList) {
+    for (const auto& it : getValues()) {
         Py::Tuple tuple(4);
         tuple.setItem(0, Py::Float(it.fMaxCurvature));
         tuple.setItem(1, Py::Float(it.fMinCurvature));
@@ -745,6 +749,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
     // before calling hasSetValue()
     Base::Reference<MeshObject> tmp(_meshObject);
     aboutToSetValue();
+    resetLazyFile();
     _meshObject = mesh;
     hasSetValue();
 }
@@ -752,6 +757,7 @@ void PropertyMeshKernel::setValuePtr(MeshObject* mesh)
 void PropertyMeshKernel::setValue(const MeshObject& mesh)
 {
     aboutToSetValue();
+    resetLazyFile();
     *_meshObject = mesh;
     hasSetValue();
 }
@@ -759,12 +765,14 @@ void PropertyMeshKernel::setValue(const MeshObject& mesh)
 void PropertyMeshKernel::setValue(const MeshCore::MeshKernel& mesh)
 {
     aboutToSetValue();
+    resetLazyFile();
     _meshObject->setKernel(mesh);
     hasSetValue();
 }
 
 void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 {
+    loadLazyFile();
     aboutToSetValue();
     _meshObject->swap(mesh);
     hasSetValue();
@@ -772,6 +780,7 @@ void PropertyMeshKernel::swapMesh(MeshObject& mesh)
 
 void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 {
+    loadLazyFile();
     aboutToSetValue();
     _meshObject->swap(mesh);
     hasSetValue();
@@ -779,21 +788,25 @@ void PropertyMeshKernel::swapMesh(MeshCore::MeshKernel& mesh)
 
 const MeshObject& PropertyMeshKernel::getValue() const
 {
+    loadLazyFile();
     return *_meshObject;
 }
 
 const MeshObject* PropertyMeshKernel::getValuePtr() const
 {
+    loadLazyFile();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 const Data::ComplexGeoData* PropertyMeshKernel::getComplexData() const
 {
+    loadLazyFile();
     return static_cast<MeshObject*>(_meshObject);
 }
 
 Base::BoundBox3d PropertyMeshKernel::getBoundingBox() const
 {
+    loadLazyFile();
     return _meshObject->getBoundBox();
 }
 
@@ -801,12 +814,14 @@ unsigned int PropertyMeshKernel::getMemSize() const
 {
     unsigned int size = 0;
     size += _meshObject->getMemSize();
+    size += static_cast<unsigned int>(getLazyFileSize());
 
     return size;
 }
 
 MeshObject* PropertyMeshKernel::startEditing()
 {
+    loadLazyFile();
     aboutToSetValue();
     return static_cast<MeshObject*>(_meshObject);
 }
@@ -818,6 +833,7 @@ void PropertyMeshKernel::finishEditing()
 
 void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 {
+    loadLazyFile();
     aboutToSetValue();
     _meshObject->transformGeometry(rclMat);
     hasSetValue();
@@ -825,6 +841,7 @@ void PropertyMeshKernel::transformGeometry(const Base::Matrix4D& rclMat)
 
 void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex, Base::Vector3f>>& inds)
 {
+    loadLazyFile();
     aboutToSetValue();
     MeshCore::MeshKernel& kernel = _meshObject->getKernel();
     for (const auto& it : inds) {
@@ -835,16 +852,19 @@ void PropertyMeshKernel::setPointIndices(const std::vector<std::pair<PointIndex,
 
 void PropertyMeshKernel::setTransform(const Base::Matrix4D& rclTrf)
 {
+    loadLazyFile();
     _meshObject->setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyMeshKernel::getTransform() const
 {
+    loadLazyFile();
     return _meshObject->getTransform();
 }
 
 PyObject* PropertyMeshKernel::getPyObject()
 {
+    loadLazyFile();
     if (!meshPyObject) {
         meshPyObject = new MeshPy(&*_meshObject);  // Lgtm[cpp/resource-not-released-in-destructor]
                                                    // ** Not destroyed in this class because it is
@@ -882,6 +902,7 @@ void PropertyMeshKernel::setPyObject(PyObject* value)
 
 void PropertyMeshKernel::Save(Base::Writer& writer) const
 {
+    loadLazyFile();
     if (writer.isForceXML()) {
         writer.Stream() << writer.ind() << "<Mesh>" << std::endl;
         MeshCore::MeshOutput saver(_meshObject->getKernel());
@@ -921,20 +942,35 @@ void PropertyMeshKernel::Restore(Base::XMLReader& reader)
 
 void PropertyMeshKernel::SaveDocFile(Base::Writer& writer) const
 {
+    loadLazyFile();
     _meshObject->save(writer.Stream());
 }
 
 void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
 {
+    resetLazyFile();
     aboutToSetValue();
     _meshObject->load(reader);
     hasSetValue();
 }
 
+bool PropertyMeshKernel::restoreDocFileLazily(const std::shared_ptr<Base::LazyDocFile>& file)
+{
+    // Read straight into the mesh, loading on first access must neither
+    // notify the owner nor record an undo step
+    return setLazyFile(file, [this](Base::Reader& reader) { _meshObject->load(reader); });
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
     // Note: Copy the content, do NOT reference the same mesh object
     PropertyMeshKernel* prop = new PropertyMeshKernel();
+    // The undo copy taken before setting a new value shares the unread data
+    // instead of loading it
+    if (copyLazyFile(*prop)) {
+        return prop;
+    }
+    loadLazyFile();
     *(prop->_meshObject) = *(this->_meshObject);
     return prop;
 }
@@ -942,8 +978,10 @@ App::Property* PropertyMeshKernel::Copy() const
 void PropertyMeshKernel::Paste(const App::Property& from)
 {
     // Note: Copy the content, do NOT reference the same mesh object
-    aboutToSetValue();
     const PropertyMeshKernel& prop = dynamic_cast<const PropertyMeshKernel&>(from);
+    prop.loadLazyFile();
+    aboutToSetValue();
+    resetLazyFile();
     *(this->_meshObject) = *(prop._meshObject);
     hasSetValue();
 }
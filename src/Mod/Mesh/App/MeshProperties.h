@@ -32,6 +32,7 @@
 
 #include <Base/Handle.h>
 #include <Base/Matrix.h>
+#include <Base/SharedVector.h>
 
 #include <Mod/Mesh/App/Core/MeshIO.h>
 #include <Mod/Mesh/App/Core/MeshKernel.h>
@@ -95,7 +96,7 @@ public:
     void transformGeometry(const Base::Matrix4D& rclMat);
 
 private:
-    std::vector<Base::Vector3f> _lValueList;
+    Base::SharedVector<Base::Vector3f> _lValueList;
 };
 
 /** Curvature information. */
@@ -171,11 +172,11 @@ public:
 
     unsigned int getMemSize() const override
     {
-        return _lValueList.size() * sizeof(CurvatureInfo);
+        return _lValueList.size() * sizeof(CurvatureInfo) / _lValueList.useCount();
     }
 
 private:
-    std::vector<CurvatureInfo> _lValueList;
+    Base::SharedVector<CurvatureInfo> _lValueList;
 };
 
 /** Mesh material properties
@@ -316,6 +317,11 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canSaveDocFileConcurrently() const override
+    {
+        return true;
+    }
+    bool restoreDocFileLazily(const std::shared_ptr<Base::LazyDocFile>& file) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -85,6 +85,13 @@ App::DocumentObjectExecReturn* Primitive::execute()
     return Part::Feature::execute();
 }
 
+bool Primitive::canRecomputeConcurrently() const
+{
+    // An attached primitive reads the shapes of other objects, which caches
+    // them in those objects
+    return AttachmentSupport.getValues().empty();
+}
+
 // suppress warning about tp_print for Py3.8
 #if defined(__clang__)
 # pragma clang diagnostic push
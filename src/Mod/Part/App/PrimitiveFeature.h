@@ -46,6 +46,7 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override;
     PyObject* getPyObject() override;
     //@}
 
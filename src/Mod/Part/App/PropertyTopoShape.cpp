@@ -66,6 +66,7 @@ PropertyPartShape::~PropertyPartShape() = default;
 void PropertyPartShape::setValue(const TopoShape& sh)
 {
     aboutToSetValue();
+    resetLazyFile();
     _Shape = sh;
     auto obj = freecad_cast<App::DocumentObject*>(getContainer());
     if (obj) {
@@ -88,6 +89,9 @@ void PropertyPartShape::setValue(const TopoShape& sh)
             _Shape.Hasher = obj->getDocument()->getStringHasher();
             _Shape.hashChildMaps();
         }
+        if (App::GetApplication().isCompactElementMapEnabled()) {
+            _Shape.compactElementMap();
+        }
     }
     hasSetValue();
     _Ver.clear();
@@ -96,6 +100,7 @@ void PropertyPartShape::setValue(const TopoShape& sh)
 void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 {
     aboutToSetValue();
+    resetLazyFile();
     auto obj = dynamic_cast<App::DocumentObject*>(getContainer());
     if (obj) {
         _Shape.Tag = obj->getID();
@@ -107,11 +112,13 @@ void PropertyPartShape::setValue(const TopoDS_Shape& sh, bool resetElementMap)
 
 const TopoDS_Shape& PropertyPartShape::getValue() const
 {
+    loadLazyFile();
     return _Shape.getShape();
 }
 
 const TopoShape& PropertyPartShape::getShape() const
 {
+    loadLazyFile();
     _Shape.initCache(-1);
     // March, 2024 Toponaming project:  There was originally an unused feature to disable
     // elementMapping that has not been kept:
@@ -128,6 +135,7 @@ const TopoShape& PropertyPartShape::getShape() const
 
 const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 {
+    loadLazyFile();
     _Shape.initCache(-1);
     return &(this->_Shape);
 }
@@ -135,6 +143,7 @@ const Data::ComplexGeoData* PropertyPartShape::getComplexData() const
 Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 {
     Base::BoundBox3d box;
+    loadLazyFile();
     if (_Shape.getShape().IsNull()) {
         return box;
     }
@@ -161,16 +170,19 @@ Base::BoundBox3d PropertyPartShape::getBoundingBox() const
 
 void PropertyPartShape::setTransform(const Base::Matrix4D& rclTrf)
 {
+    loadLazyFile();
     _Shape.setTransform(rclTrf);
 }
 
 Base::Matrix4D PropertyPartShape::getTransform() const
 {
+    loadLazyFile();
     return _Shape.getTransform();
 }
 
 void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 {
+    loadLazyFile();
     aboutToSetValue();
     _Shape.transformGeometry(rclTrf);
     hasSetValue();
@@ -178,6 +190,7 @@ void PropertyPartShape::transformGeometry(const Base::Matrix4D& rclTrf)
 
 PyObject* PropertyPartShape::getPyObject()
 {
+    loadLazyFile();
     Base::PyObjectBase* prop = static_cast<Base::PyObjectBase*>(_Shape.getPyObject());
     if (prop) {
         prop->setConst();
@@ -217,6 +230,14 @@ void PropertyPartShape::setPyObject(PyObject* value)
 App::Property* PropertyPartShape::Copy() const
 {
     PropertyPartShape* prop = new PropertyPartShape();
+    // The undo copy taken before setting a new value shares the unread data
+    // instead of loading it
+    prop->_Shape = this->_Shape;
+    prop->_Ver = this->_Ver;
+    if (copyLazyFile(*prop)) {
+        return prop;
+    }
+    loadLazyFile();
 
     // March, 2024 Toponaming project:  There was originally a feature to enable making an element
     // copy ( new geometry and map ) that has not been kept:
@@ -234,14 +255,28 @@ void PropertyPartShape::Paste(const App::Property& from)
 {
     auto prop = freecad_cast<const PropertyPartShape*>(&from);
     if (prop) {
-        setValue(prop->_Shape);
+        prop->loadLazyFile();
+        auto owner = freecad_cast<App::DocumentObject*>(getContainer());
+        auto hasher = owner && owner->getDocument() ? owner->getDocument()->getStringHasher()
+                                                    : App::StringHasherRef();
+        const auto& shape = prop->_Shape;
+        if (hasher && shape.Hasher && shape.Hasher != hasher && shape.getElementMapSize() > 0) {
+            // Map the element names to the string hasher of this document,
+            // e.g. when an object is copied from another document
+            TopoShape res(owner->getID(), hasher, shape.getShape());
+            res.mapSubElement(shape);
+            setValue(res);
+        }
+        else {
+            setValue(shape);
+        }
         _Ver = prop->_Ver;
     }
 }
 
 unsigned int PropertyPartShape::getMemSize() const
 {
-    return _Shape.getMemSize();
+    return static_cast<unsigned int>(_Shape.getMemSize() + getLazyFileSize());
 }
 
 void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier>& paths) const
@@ -352,6 +387,7 @@ void PropertyPartShape::getPaths(std::vector<App::ObjectIdentifier>& paths) cons
 
 void PropertyPartShape::beforeSave() const
 {
+    loadLazyFile();
     _HasherIndex = 0;
     _SaveHasher = false;
     auto owner = freecad_cast<App::DocumentObject*>(getContainer());
@@ -365,6 +401,7 @@ void PropertyPartShape::beforeSave() const
 void PropertyPartShape::Save(Base::Writer& writer) const
 {
     // See SaveDocFile(), RestoreDocFile()
+    loadLazyFile();
     writer.Stream() << writer.ind() << "<Part";
     auto owner = dynamic_cast<App::DocumentObject*>(getContainer());
     if (owner && !_Shape.isNull() && _Shape.getElementMapSize() > 0 && !_Shape.Hasher.isNull()) {
@@ -389,6 +426,8 @@ void PropertyPartShape::Save(Base::Writer& writer) const
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
     if (!toXML) {
+        // SaveDocFile() may run on a worker thread, which must not access the parameters
+        _SaveDirectAccess = isDirectAccess();
         writer.Stream() << " file=\""
                         << writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this)
                         << "\"/>\n";
@@ -548,6 +587,14 @@ void PropertyPartShape::afterRestore()
     PropertyComplexGeoData::afterRestore();
 }
 
+static bool isDirectAccess()
+{
+    static const ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    return hGrp->GetBool("DirectAccess", true);
+}
+
 // The following function is copied from OCCT BRepTools.cxx and modified
 // to disable saving of triangulation
 //
@@ -709,10 +756,17 @@ void PropertyPartShape::loadFromStream(Base::Reader& reader)
     }
 }
 
+bool PropertyPartShape::canSaveDocFileConcurrently() const
+{
+    // saveToFile() goes through a single temporary file
+    return _SaveDirectAccess;
+}
+
 void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
 {
     // If the shape is empty we simply store nothing. The file size will be 0 which
     // can be checked when reading in the data.
+    loadLazyFile();
     if (_Shape.getShape().IsNull()) {
         return;
     }
@@ -723,10 +777,7 @@ void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
         shape.exportBinary(writer.Stream());
     }
     else {
-        bool direct = App::GetApplication()
-                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
-                          ->GetBool("DirectAccess", true);
-        if (!direct) {
+        if (!_SaveDirectAccess) {
             saveToFile(writer);
         }
         else {
@@ -739,6 +790,7 @@ void PropertyPartShape::SaveDocFile(Base::Writer& writer) const
 
 void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
 {
+    resetLazyFile();
 
     // save the element map
     auto elementMap = _Shape.resetElementMap();
@@ -760,10 +812,7 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
         shape.importBinary(reader);
     }
     else {
-        bool direct = App::GetApplication()
-                          .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
-                          ->GetBool("DirectAccess", true);
-        if (!direct) {
+        if (!isDirectAccess()) {
             loadFromFile(reader);
         }
         else {
@@ -779,6 +828,30 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
     shape.resetElementMap(elementMap);
     setValue(shape);
     _Ver = ver;
+
+    // setValue() cannot compact the map while the local copies share it
+    if (App::GetApplication().isCompactElementMapEnabled()) {
+        elementMap.reset();
+        shape = TopoShape();
+        _Shape.compactElementMap();
+    }
+}
+
+bool PropertyPartShape::restoreDocFileLazily(const std::shared_ptr<Base::LazyDocFile>& file)
+{
+    return setLazyFile(file, [this](Base::Reader& reader) {
+        // Restore into a detached copy, so that loading on first access
+        // neither notifies the owner nor records an undo step
+        PropertyPartShape prop;
+        prop._Shape = _Shape;
+        prop._Ver = _Ver;
+        prop.RestoreDocFile(reader);
+        if (auto owner = freecad_cast<App::DocumentObject*>(getContainer())) {
+            prop._Shape.Tag = owner->getID();
+        }
+        _Shape = prop._Shape;
+        _Ver = prop._Ver;
+    });
 }
 
 // -------------------------------------------------------------------------
@@ -93,6 +93,8 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canSaveDocFileConcurrently() const override;
+    bool restoreDocFileLazily(const std::shared_ptr<Base::LazyDocFile>& file) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -122,6 +124,8 @@ private:
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    /// The DirectAccess preference, read by Save() for SaveDocFile() on a worker thread
+    mutable bool _SaveDirectAccess = true;
 };
 
 struct PartExport ShapeHistory
@@ -1311,6 +1311,20 @@ unsigned int TopoShape::getMemSize() const
                     // first, last, tolerance
                     memsize += 5 * sizeof(Standard_Real);
                     const TopoDS_Face& face = TopoDS::Face(shape);
+                    // the tessellation is kept with the face
+                    TopLoc_Location loc;
+                    Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(face, loc);
+                    if (!mesh.IsNull()) {
+                        memsize += sizeof(Poly_Triangulation);
+                        memsize += mesh->NbNodes() * sizeof(gp_Pnt);
+                        memsize += mesh->NbTriangles() * sizeof(Poly_Triangle);
+                        if (mesh->HasUVNodes()) {
+                            memsize += mesh->NbNodes() * sizeof(gp_Pnt2d);
+                        }
+                        if (mesh->HasNormals()) {
+                            memsize += mesh->NbNodes() * 3 * sizeof(Standard_ShortReal);
+                        }
+                    }
                     // if no geometry is attached to a face an exception is raised
                     BRepAdaptor_Surface surface;
                     try {
@@ -1424,8 +1438,8 @@ unsigned int TopoShape::getMemSize() const
             }
         }
 
-        // estimated memory usage
-        return memsize;
+        // estimated memory usage, including the element map
+        return memsize + static_cast<unsigned int>(getElementMapMemSize());
     }
 
     // in case the shape is invalid
@@ -120,6 +120,10 @@ public:
     void SaveDocFile(Base::Writer& writer) const override;
     void Restore(Base::XMLReader& reader) override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canSaveDocFileConcurrently() const override
+    {
+        return true;
+    }
     void save(const char* file) const;
     void save(std::ostream&) const;
     void load(const char* file);
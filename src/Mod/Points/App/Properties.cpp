@@ -80,9 +80,10 @@ void PropertyGreyValueList::setValues(const std::vector<float>& values)
 
 PyObject* PropertyGreyValueList::getPyObject()
 {
+    const std::vector<float>& values = getValues();
     PyObject* list = PyList_New(getSize());
     for (int i = 0; i < getSize(); i++) {
-        PyList_SetItem(list, i, PyFloat_FromDouble(_lValueList[i]));
+        PyList_SetItem(list, i, PyFloat_FromDouble(values[i]));
     }
     return list;
 }
@@ -183,7 +184,8 @@ void PropertyGreyValueList::Paste(const App::Property& from)
 
 unsigned int PropertyGreyValueList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(float));
+    // copies share the values until either one is modified
+    return static_cast<unsigned int>(_lValueList.size() * sizeof(float) / _lValueList.useCount());
 }
 
 void PropertyGreyValueList::removeIndices(const std::vector<unsigned long>& uIndices)
@@ -256,10 +258,11 @@ void PropertyNormalList::setValues(const std::vector<Base::Vector3f>& values)
 
 PyObject* PropertyNormalList::getPyObject()
 {
+    const std::vector<Base::Vector3f>& values = getValues();
     PyObject* list = PyList_New(getSize());
 
     for (int i = 0; i < getSize(); i++) {
-        PyList_SetItem(list, i, new Base::VectorPy(_lValueList[i]));
+        PyList_SetItem(list, i, new Base::VectorPy(values[i]));
     }
 
     return list;
@@ -355,7 +358,9 @@ void PropertyNormalList::Paste(const App::Property& from)
 
 unsigned int PropertyNormalList::getMemSize() const
 {
-    return static_cast<unsigned int>(_lValueList.size() * sizeof(Base::Vector3f));
+    return static_cast<unsigned int>(
+        _lValueList.size() * sizeof(Base::Vector3f) / _lValueList.useCount()
+    );
 }
 
 void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
@@ -388,7 +393,7 @@ void PropertyNormalList::transformGeometry(const Base::Matrix4D& mat)
         value = rot * value;
     });
 #else
-    QtConcurrent::blockingMap(_lValueList, [rot](Base::Vector3f& value) {
+    QtConcurrent::blockingMap(_lValueList.detach(), [rot](Base::Vector3f& value) {
         rot.multVec(value, value);
     });
 #endif
@@ -541,10 +546,11 @@ void PropertyCurvatureList::removeIndices(const std::vector<unsigned long>& uInd
     std::vector<CurvatureInfo> remainValue;
     remainValue.reserve(_lValueList.size() - uSortedInds.size());
 
+    const std::vector<CurvatureInfo>& rValueList = getValues();
     std::vector<unsigned long>::iterator pos = uSortedInds.begin();
-    for (std::vector<CurvatureInfo>::const_iterator it = _lValueList.begin(); it != _lValueList.end();
+    for (std::vector<CurvatureInfo>::const_iterator it = rValueList.begin(); it != rValueList.end();
          ++it) {
-        unsigned long index = it - _lValueList.begin();
+        unsigned long index = it - rValueList.begin();
         if (pos == uSortedInds.end()) {
             remainValue.push_back(*it);
         }
@@ -634,5 +640,5 @@ void PropertyCurvatureList::Paste(const App::Property& from)
 
 unsigned int PropertyCurvatureList::getMemSize() const
 {
-    return sizeof(CurvatureInfo) * this->_lValueList.size();
+    return sizeof(CurvatureInfo) * this->_lValueList.size() / this->_lValueList.useCount();
 }
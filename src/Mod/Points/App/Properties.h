@@ -29,6 +29,7 @@
 #include <App/PropertyStandard.h>
 #include <Base/Matrix.h>
 #include <Base/Reader.h>
+#include <Base/SharedVector.h>
 #include <Base/Writer.h>
 
 #include "Points.h"
@@ -97,7 +98,7 @@ public:
     //@}
 
 private:
-    std::vector<float> _lValueList;
+    Base::SharedVector<float> _lValueList;
 };
 
 class PointsExport PropertyNormalList: public App::PropertyLists
@@ -151,7 +152,7 @@ public:
     //@}
 
 private:
-    std::vector<Base::Vector3f> _lValueList;
+    Base::SharedVector<Base::Vector3f> _lValueList;
 };
 
 /** Curvature information. */
@@ -234,7 +235,7 @@ public:
     //@}
 
 private:
-    std::vector<CurvatureInfo> _lValueList;
+    Base::SharedVector<CurvatureInfo> _lValueList;
 };
 
 }  // namespace Points
@@ -57,6 +57,11 @@ public:
 
     void Save(Base::Writer& /*writer*/) const override;
     void Restore(Base::XMLReader& /*reader*/) override;
+    /// The robot is copied by saving it.
+    bool canCopyInMemory() const override
+    {
+        return false;
+    }
 
     Robot6Axis& getRobot()
     {
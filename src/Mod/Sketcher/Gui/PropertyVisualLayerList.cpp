@@ -101,7 +101,7 @@ Property* PropertyVisualLayerList::Copy() const
 
 void PropertyVisualLayerList::Paste(const Property& from)
 {
-    setValues(dynamic_cast<const PropertyVisualLayerList&>(from)._lValueList);
+    shareValues(dynamic_cast<const PropertyVisualLayerList&>(from));
 }
 
 unsigned int PropertyVisualLayerList::getMemSize() const
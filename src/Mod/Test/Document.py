@@ -2502,6 +2502,27 @@ class DocumentObserverCases(unittest.TestCase):
         FreeCAD.closeDocument(self.Doc1.Name)
         self.Obs.clear()
 
+    def testBulkUpdate(self):
+        self.Doc1 = FreeCAD.newDocument("Observer1")
+        self.Obs.clear()
+
+        # the signals are deferred until the with statement is left
+        with self.assertRaises(ValueError):
+            with self.Doc1.bulkUpdate():
+                obj = self.Doc1.addObject("App::FeaturePython", "obj")
+                self.assertNotIn("ObjCreated", self.Obs.signal)
+                raise ValueError("leave the bulk update")
+        self.assertIn("ObjCreated", self.Obs.signal)
+        self.assertIs(self.Obs.parameter[self.Obs.signal.index("ObjCreated")], obj)
+
+        # the bulk update ended, so a new object is signaled right away
+        self.Obs.clear()
+        self.Doc1.addObject("App::FeaturePython", "obj2")
+        self.assertIn("ObjCreated", self.Obs.signal)
+
+        FreeCAD.closeDocument(self.Doc1.Name)
+        self.Obs.clear()
+
     def testGuiObserver(self):
 
         if not FreeCAD.GuiUp:
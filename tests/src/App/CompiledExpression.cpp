@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/CompiledExpression.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/Expression.h>
+#include <App/ExpressionParser.h>
+#include <App/PropertyStandard.h>
+#include <App/PropertyUnits.h>
+#include <Base/Quantity.h>
+
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+class CompiledExpressionTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _obj = _doc->addObject("App::VarSet", "Vars");
+        _other = _doc->addObject("App::VarSet", "Other");
+
+        freecad_cast<App::PropertyInteger*>(
+            _obj->addDynamicProperty("App::PropertyInteger", "Count"))
+            ->setValue(7);
+        freecad_cast<App::PropertyFloat*>(_obj->addDynamicProperty("App::PropertyFloat", "Ratio"))
+            ->setValue(0.25);
+        freecad_cast<App::PropertyBool*>(_obj->addDynamicProperty("App::PropertyBool", "Flag"))
+            ->setValue(true);
+        freecad_cast<App::PropertyLength*>(_obj->addDynamicProperty("App::PropertyLength", "Width"))
+            ->setValue(12.5);
+        freecad_cast<App::PropertyAngle*>(_obj->addDynamicProperty("App::PropertyAngle", "Tilt"))
+            ->setValue(30.0);
+        freecad_cast<App::PropertyLength*>(
+            _other->addDynamicProperty("App::PropertyLength", "Height"))
+            ->setValue(4.0);
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    App::DocumentObject* obj()
+    {
+        return _obj;
+    }
+
+    App::DocumentObject* other()
+    {
+        return _other;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::DocumentObject* _obj {};
+    App::DocumentObject* _other {};
+};
+
+TEST_F(CompiledExpressionTest, matchesInterpreter)
+{
+    std::vector<std::string> sources {
+        "1 + 2",
+        "Count * 3 - 1",
+        "Count / 2",
+        "Count % 3",
+        "-Count % 3",
+        "Count ** 2",
+        "2 ** -1",
+        "Ratio * 4",
+        "Ratio + Count",
+        "7.5 % -2",
+        "Flag + 1",
+        "Width * 2",
+        "Width + 1 mm",
+        "Width / Other.Height",
+        "Width * Other.Height",
+        "Width % 5 mm",
+        "Width ^ 2",
+        "-Width",
+        "Flag ? Width : Other.Height",
+        "Count < 3 ? 1 : Ratio",
+        "sin(Tilt)",
+        "sqrt(Count + 9)",
+        "atan2(Width; Other.Height)",
+        "hypot(3; 4)",
+        "mod(Width; 5)",
+        "pow(Width; 2)",
+        "round(Ratio * 10)",
+        "not(Flag)",
+        "abs(-Width) + 2 * Other.Height",
+        "1 in",
+        "pi * 2",
+        "True + False",
+    };
+
+    for (const auto& source : sources) {
+        SCOPED_TRACE(source);
+        App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), source.c_str());
+        auto compiled = App::CompiledExpression::compile(expr.get());
+        ASSERT_TRUE(compiled);
+
+        App::any value;
+        ASSERT_TRUE(compiled->eval(value));
+        App::any expected = expr->getValueAsAny();
+        EXPECT_EQ(value.type(), expected.type());
+        EXPECT_TRUE(App::isAnyEqual(value, expected));
+    }
+}
+
+TEST_F(CompiledExpressionTest, comparisonsReturnBool)
+{
+    std::vector<std::string> sources {
+        "Width > Other.Height",
+        "Width <= Other.Height",
+        "Count == 7",
+        "Count > Ratio",
+        "Flag == True",
+    };
+
+    for (const auto& source : sources) {
+        SCOPED_TRACE(source);
+        App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), source.c_str());
+        auto compiled = App::CompiledExpression::compile(expr.get());
+        ASSERT_TRUE(compiled);
+
+        App::any value;
+        ASSERT_TRUE(compiled->eval(value));
+        EXPECT_EQ(value.type(), typeid(bool));
+        EXPECT_TRUE(App::isAnyEqual(value, expr->getValueAsAny()));
+    }
+}
+
+TEST_F(CompiledExpressionTest, unsupportedExpressions)
+{
+    std::vector<std::string> sources {
+        "<<text>>",
+        "Label",
+        "vector(1; 2; 3)",
+        "Placement.Base.x",
+        "sum(1; 2)",
+        "None",
+    };
+
+    for (const auto& source : sources) {
+        SCOPED_TRACE(source);
+        App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), source.c_str());
+        EXPECT_FALSE(App::CompiledExpression::compile(expr.get()));
+    }
+}
+
+TEST_F(CompiledExpressionTest, evaluationErrorsFallBack)
+{
+    // Errors and results outside of the compiled value range are left to the interpreter
+    std::vector<std::string> sources {
+        "Count / 0",
+        "Count % 0",
+        "Width + Count",
+        "Width < 1",
+        "Count ** 40",
+        "(-8) ** 0.5",
+    };
+
+    for (const auto& source : sources) {
+        SCOPED_TRACE(source);
+        App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), source.c_str());
+        auto compiled = App::CompiledExpression::compile(expr.get());
+        ASSERT_TRUE(compiled);
+        App::any value;
+        EXPECT_FALSE(compiled->eval(value));
+    }
+}
+
+TEST_F(CompiledExpressionTest, readsCurrentPropertyValues)
+{
+    App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), "Count * 2");
+    auto compiled = App::CompiledExpression::compile(expr.get());
+    ASSERT_TRUE(compiled);
+
+    freecad_cast<App::PropertyInteger*>(obj()->getPropertyByName("Count"))->setValue(21);
+
+    App::any value;
+    ASSERT_TRUE(compiled->eval(value));
+    EXPECT_EQ(App::any_cast<long>(value), 42);
+}
+
+TEST_F(CompiledExpressionTest, invalidatedByStructuralChanges)
+{
+    App::ExpressionPtr expr = App::ExpressionParser::parse(obj(), "Other.Height * 2");
+    auto compiled = App::CompiledExpression::compile(expr.get());
+    ASSERT_TRUE(compiled);
+    EXPECT_TRUE(compiled->isValid());
+
+    other()->removeDynamicProperty("Height");
+
+    App::any value;
+    EXPECT_FALSE(compiled->isValid());
+    EXPECT_FALSE(compiled->eval(value));
+    EXPECT_FALSE(App::CompiledExpression::compile(expr.get()));
+
+    compiled = App::CompiledExpression::compile(
+        App::ExpressionParser::parse(obj(), "Count + 1").get());
+    ASSERT_TRUE(compiled);
+    other()->Label.setValue("Renamed");
+    EXPECT_FALSE(compiled->isValid());
+}
+
+TEST_F(CompiledExpressionTest, notInvalidatedByOtherDocuments)
+{
+    std::string name = App::GetApplication().getUniqueDocumentName("other");
+    auto otherDoc = App::GetApplication().newDocument(name.c_str(), "testUser");
+    auto compiled = App::CompiledExpression::compile(
+        App::ExpressionParser::parse(obj(), "Count + 1").get());
+    ASSERT_TRUE(compiled);
+
+    auto vars = otherDoc->addObject("App::VarSet", "Vars");
+    vars->addDynamicProperty("App::PropertyInteger", "Count");
+    vars->Label.setValue("Renamed");
+
+    EXPECT_TRUE(compiled->isValid());
+    App::GetApplication().closeDocument(name.c_str());
+}
+
+TEST_F(CompiledExpressionTest, usedByExpressionEngine)
+{
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Expression");
+    bool enabled = hGrp->GetBool("CompileExpressions", false);
+    hGrp->SetBool("CompileExpressions", true);
+
+    auto target = obj()->addDynamicProperty("App::PropertyLength", "Result");
+    App::ObjectIdentifier path(*target);
+    std::shared_ptr<App::Expression> expr(
+        App::ExpressionParser::parse(obj(), "Flag ? Width * 2 : Other.Height"));
+    obj()->setExpression(path, expr);
+    obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(freecad_cast<App::PropertyLength*>(target)->getValue(), 25.0);
+
+    freecad_cast<App::PropertyBool*>(obj()->getPropertyByName("Flag"))->setValue(false);
+    obj()->ExpressionEngine.execute();
+    EXPECT_DOUBLE_EQ(freecad_cast<App::PropertyLength*>(target)->getValue(), 4.0);
+
+    hGrp->SetBool("CompileExpressions", enabled);
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(CompiledExpressionTest, DISABLED_evaluationTimeVersusInterpreter)
+{
+    const int count = 100000;
+    App::ExpressionPtr expr = App::ExpressionParser::parse(
+        obj(),
+        "Flag ? sqrt(Width * Width + Other.Height ^ 2) / 2 + Count * 1 mm : Width");
+    auto compiled = App::CompiledExpression::compile(expr.get());
+    ASSERT_TRUE(compiled);
+
+    App::any value;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        value = expr->getValueAsAny();
+    }
+    auto interpreted = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        compiled->eval(value);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    std::cout << "interpreter: " << interpreted.count() * 1000 / count << " ns per evaluation\n";
+    std::cout << "compiled: " << elapsed.count() * 1000 / count << " ns per evaluation ("
+              << compiled->size() << " instructions)\n";
+}
+
+// NOLINTEND(readability-magic-numbers)
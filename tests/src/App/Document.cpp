@@ -3,11 +3,24 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <thread>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/Expression.h"
+#include "App/FeatureTest.h"
+#include "App/ObjectIdentifier.h"
+#include "App/PropertyFile.h"
+#include "App/RecomputeCache.h"
+#include "App/RecomputeProfiler.h"
 #include "App/StringHasher.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
+#include <src/App/ScopedParameter.h>
 
 using ::testing::Eq;
 using ::testing::Ne;
@@ -24,6 +37,15 @@ class FakeWriter: public Base::Writer
     }
 };
 
+// Sets a document preference and restores it when going out of scope
+class ScopedDocumentParameter: public tests::ScopedParameter
+{
+public:
+    ScopedDocumentParameter(const char* name, bool value)
+        : ScopedParameter("User parameter:BaseApp/Preferences/Document", name, value)
+    {}
+};
+
 class DocumentTest: public ::testing::Test
 {
 protected:
@@ -94,4 +116,620 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+TEST_F(DocumentTest, parallelRecomputeExecutesIndependentBranches)
+{
+    // Arrange
+    ScopedDocumentParameter parallel("ParallelRecompute", true);
+
+    // Two independent chains joined by a common result: A1 -> B1, A2 -> B2, C(B1, B2)
+    std::vector<App::FeatureTest*> features;
+    for (const char* name : {"A1", "B1", "A2", "B2", "C"}) {
+        features.push_back(static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", name)));
+    }
+    features[1]->Source1.setValue(features[0]);
+    features[3]->Source1.setValue(features[2]);
+    features[4]->Source1.setValue(features[1]);
+    features[4]->Source2.setValue(features[3]);
+
+    // Act
+    int count = doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(count, 5);
+    for (auto feature : features) {
+        EXPECT_EQ(feature->ExecCount.getValue(), 1);
+        EXPECT_FALSE(feature->isTouched());
+    }
+}
+
+TEST_F(DocumentTest, parallelRecomputeSignalsChangesOnCallingThread)
+{
+    // Arrange
+    ScopedDocumentParameter parallel("ParallelRecompute", true);
+    std::vector<App::FeatureTest*> features;
+    for (const char* name : {"A", "B", "C", "D"}) {
+        features.push_back(static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", name)));
+    }
+    std::vector<std::thread::id> threads;
+    std::vector<const App::DocumentObject*> executed;
+    fastsignals::scoped_connection conn = doc()->signalChangedObject.connect(
+        [&](const App::DocumentObject& obj, const App::Property& prop) {
+            threads.push_back(std::this_thread::get_id());
+            if (std::string(prop.getName()) == "ExecCount") {
+                executed.push_back(&obj);
+            }
+        });
+
+    // Act
+    int count = doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(count, 4);
+    EXPECT_THAT(executed, ::testing::UnorderedElementsAreArray(features));
+    for (auto id : threads) {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
+TEST_F(DocumentTest, parallelRecomputeReportsUnknownExceptions)
+{
+    // Arrange
+    ScopedDocumentParameter parallel("ParallelRecompute", true);
+    std::vector<App::FeatureTest*> features;
+    for (const char* name : {"Throws1", "Throws2", "Valid"}) {
+        features.push_back(static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", name)));
+    }
+    features[0]->ExceptionType.setValue(3);
+    features[1]->ExceptionType.setValue(3);
+
+    // Act
+    bool hasError = false;
+    doc()->recompute({}, false, &hasError);
+
+    // Assert
+    EXPECT_TRUE(hasError);
+    EXPECT_TRUE(features[0]->isError());
+    EXPECT_TRUE(features[1]->isError());
+    EXPECT_FALSE(features[2]->isError());
+    EXPECT_EQ(features[2]->ExecCount.getValue(), 1);
+}
+
+TEST_F(DocumentTest, recomputeOrderFollowsLinkChanges)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    second->Source1.setValue(first);
+    std::vector<std::string> order;
+    auto connection = doc()->signalRecomputedObject.connect(
+        [&order](const App::DocumentObject& obj) { order.emplace_back(obj.getNameInDocument()); });
+
+    // Act
+    doc()->recompute();
+    first->touch();
+    second->touch();
+    doc()->recompute();
+    second->Source1.setValue(nullptr);
+    first->Source1.setValue(second);
+    doc()->recompute();
+    connection.disconnect();
+
+    // Assert
+    EXPECT_THAT(order,
+                ::testing::ElementsAre("First", "Second", "First", "Second", "Second", "First"));
+}
+
+TEST_F(DocumentTest, recomputeCacheRestoresResultOfIdenticalInput)
+{
+    // Arrange
+    ScopedDocumentParameter cacheEnabled("RecomputeCache", true);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Cached"));
+    const auto& cache = doc()->getRecomputeCache();
+
+    // Act
+    feature->Integer.setValue(1);
+    doc()->recompute();
+    feature->Integer.setValue(2);
+    doc()->recompute();
+    feature->Integer.setValue(1);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(cache.getHits(), 1U);
+    EXPECT_EQ(cache.getMisses(), 2U);
+    EXPECT_EQ(cache.getEntryCount(), 2U);
+    // The restored result is the one of the first execution
+    EXPECT_EQ(feature->ExecCount.getValue(), 1);
+    EXPECT_FALSE(feature->isTouched());
+}
+
+TEST_F(DocumentTest, recomputeCacheMissesAfterDependencyChangedWithoutExecution)
+{
+    // Arrange
+    ScopedDocumentParameter cacheEnabled("RecomputeCache", true);
+    auto upstream = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Upstream"));
+    auto downstream =
+        static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Downstream"));
+    downstream->Source1.setValue(upstream);
+    doc()->recompute();
+
+    // Act
+    upstream->Integer.setValue(5);
+    doc()->recomputeFeature(downstream);
+
+    // Assert
+    EXPECT_EQ(doc()->getRecomputeCache().getHits(), 0U);
+    EXPECT_EQ(downstream->ExecCount.getValue(), 2);
+}
+
+TEST_F(DocumentTest, recomputeCacheMissesAfterDependencyExecutedWhileDisabled)
+{
+    // Arrange
+    ScopedDocumentParameter cacheEnabled("RecomputeCache", true);
+    auto upstream = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Upstream"));
+    auto downstream =
+        static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Downstream"));
+    downstream->Source1.setValue(upstream);
+    doc()->recompute();
+
+    // Act
+    {
+        ScopedDocumentParameter cacheDisabled("RecomputeCache", false);
+        upstream->Integer.setValue(5);
+        doc()->recomputeFeature(upstream);
+    }
+    doc()->recomputeFeature(downstream);
+
+    // Assert
+    EXPECT_EQ(doc()->getRecomputeCache().getHits(), 0U);
+    EXPECT_EQ(downstream->ExecCount.getValue(), 2);
+}
+
+TEST_F(DocumentTest, recomputeCacheRestoresDownstreamAfterUpstreamHit)
+{
+    // Arrange
+    ScopedDocumentParameter cacheEnabled("RecomputeCache", true);
+    auto upstream = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Upstream"));
+    auto downstream =
+        static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Downstream"));
+    downstream->Source1.setValue(upstream);
+
+    // Act
+    upstream->Integer.setValue(1);
+    doc()->recompute();
+    upstream->Integer.setValue(2);
+    doc()->recompute();
+    upstream->Integer.setValue(1);
+    doc()->recompute();
+
+    // Assert
+    EXPECT_EQ(doc()->getRecomputeCache().getHits(), 2U);
+    EXPECT_EQ(upstream->ExecCount.getValue(), 1);
+    EXPECT_EQ(downstream->ExecCount.getValue(), 1);
+}
+
+TEST_F(DocumentTest, recomputeCacheHashesFileContent)
+{
+    // Arrange
+    ScopedDocumentParameter cacheEnabled("RecomputeCache", true);
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Cached"));
+    auto file = dynamic_cast<App::PropertyFileIncluded*>(
+        feature->addDynamicProperty("App::PropertyFileIncluded", "File"));
+    ASSERT_NE(file, nullptr);
+    auto path = std::filesystem::temp_directory_path() / "recomputeCache.txt";
+    auto setContent = [&path, file](const char* content) {
+        std::ofstream(path) << content;
+        file->setValue(path.string().c_str());
+    };
+
+    // Act
+    setContent("first");
+    doc()->recompute();
+    setContent("second");
+    doc()->recompute();
+    std::filesystem::remove(path);
+
+    // Assert
+    EXPECT_EQ(doc()->getRecomputeCache().getHits(), 0U);
+    EXPECT_EQ(feature->ExecCount.getValue(), 2);
+}
+
+TEST_F(DocumentTest, recomputeProfileRecordsExecutedObjects)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    second->Source1.setValue(first);
+    auto& profiler = doc()->getRecomputeProfiler();
+    profiler.clear();
+
+    // Act
+    doc()->recompute();
+    second->touch();
+    doc()->recompute();
+    auto history = profiler.getHistory();
+
+    // Assert
+    ASSERT_EQ(history.size(), 2U);
+    ASSERT_EQ(history[0].objects.size(), 2U);
+    EXPECT_EQ(history[0].objects[0].name, "First");
+    EXPECT_EQ(history[0].objects[0].type, "App::FeatureTest");
+    EXPECT_EQ(history[0].objects[0].executions, 1);
+    EXPECT_EQ(history[0].objects[1].name, "Second");
+    ASSERT_EQ(history[1].objects.size(), 1U);
+    EXPECT_EQ(history[1].objects[0].name, "Second");
+    EXPECT_GE(history[1].time, history[1].objects[0].time);
+    EXPECT_NE(profiler.toJson().find("\"Name\": \"Second\""), std::string::npos);
+}
+
+TEST_F(DocumentTest, undoLimitDropsOldestTransactions)
+{
+    // Arrange
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Undo"));
+    doc()->clearUndos();
+    std::vector<double> values(10000, 1.0);
+
+    // Act
+    for (int i = 0; i < 5; ++i) {
+        doc()->openTransaction("change");
+        values[0] = i;
+        feature->FloatList.setValues(values);
+        doc()->commitTransaction();
+    }
+    auto unlimitedSize = doc()->getUndoMemSize();
+    doc()->setUndoLimit(unlimitedSize / 2);
+
+    // Assert
+    // every transaction but the first one stores a copy of the previous list
+    EXPECT_GE(unlimitedSize, 4 * values.size() * sizeof(double));
+    EXPECT_LT(doc()->getAvailableUndos(), 5);
+    EXPECT_GE(doc()->getAvailableUndos(), 1);
+    EXPECT_LE(doc()->getUndoMemSize(), unlimitedSize / 2);
+}
+
+TEST_F(DocumentTest, memoryUsageBreaksDownDocument)
+{
+    // Arrange
+    auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Memory"));
+    doc()->addObject("App::FeatureTest", "Other");
+    doc()->clearUndos();
+    std::vector<double> values(10000, 1.0);
+
+    // Act
+    doc()->openTransaction("change");
+    feature->FloatList.setValues(values);
+    doc()->commitTransaction();
+    auto usage = doc()->getMemoryUsage();
+    auto memSize = doc()->getMemSize();
+    // the transaction stores the previous values
+    doc()->openTransaction("change");
+    feature->FloatList.setValues({});
+    doc()->commitTransaction();
+    auto undoSize = doc()->getMemoryUsage().undo;
+    doc()->undo();
+    auto restored = doc()->getMemoryUsage();
+    // the other object shares the values of the feature
+    auto other = static_cast<App::FeatureTest*>(doc()->getObject("Other"));
+    other->FloatList.Paste(feature->FloatList);
+    auto shared = doc()->getMemoryUsage();
+
+    // Assert
+    ASSERT_EQ(usage.objects.size(), 2U);
+    EXPECT_GE(usage.objects["Memory"], values.size() * sizeof(double));
+    EXPECT_LT(usage.objects["Other"], usage.objects["Memory"]);
+    EXPECT_GE(usage.propertyTypes["App::PropertyFloatList"], values.size() * sizeof(double));
+    EXPECT_GT(usage.documentProperties, 0U);
+    EXPECT_EQ(usage.redo, 0U);
+    EXPECT_EQ(usage.total(), memSize);
+    EXPECT_GE(undoSize, usage.undo + values.size() * sizeof(double));
+    EXPECT_GT(restored.redo, 0U);
+    // sharing the values must not count them twice
+    EXPECT_LE(shared.propertyTypes["App::PropertyFloatList"],
+              restored.propertyTypes["App::PropertyFloatList"]);
+    EXPECT_LE(shared.total(), restored.total());
+}
+
+TEST_F(DocumentTest, parallelRestoreReadsListProperties)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    long oldValue = hGrp->GetInt("RestoreThreads", 1);
+    hGrp->SetInt("RestoreThreads", 4);
+    for (long i = 0; i < 50; ++i) {
+        auto feature =
+            static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Restore"));
+        feature->IntegerList.setValues({i, i + 1, i + 2});
+        feature->StringList.setValues({"<a & b>", std::to_string(i)});
+    }
+    auto path = std::filesystem::temp_directory_path() / "parallelRestore.FCStd";
+    doc()->saveAs(path.string().c_str());
+
+    // Act
+    doc()->restore(path.string().c_str());
+    hGrp->SetInt("RestoreThreads", oldValue);
+    std::filesystem::remove(path);
+
+    // Assert
+    auto objs = doc()->getObjectsOfType(App::FeatureTest::getClassTypeId());
+    ASSERT_EQ(objs.size(), 50U);
+    for (long i = 0; i < 50; ++i) {
+        auto feature = static_cast<App::FeatureTest*>(objs[i]);
+        EXPECT_THAT(feature->IntegerList.getValues(), ::testing::ElementsAre(i, i + 1, i + 2));
+        EXPECT_THAT(feature->StringList.getValues(),
+                    ::testing::ElementsAre("<a & b>", std::to_string(i)));
+    }
+}
+
+TEST_F(DocumentTest, batchClosesDocumentsClosedOrFailedByTheScript)
+{
+    // Arrange
+    auto& app = App::GetApplication();
+    std::string name = app.getUniqueDocumentName("batch");
+    auto batchDoc = app.newDocument(name.c_str(), "testUser");
+    batchDoc->addObject("App::FeatureTest", "Batch");
+    auto dir = std::filesystem::temp_directory_path();
+    auto path = dir / "batchDocument.FCStd";
+    batchDoc->saveAs(path.string().c_str());
+    app.closeDocument(name.c_str());
+    auto closing = dir / "batchClose.py";
+    std::ofstream(closing) << "import FreeCAD\n"
+                              "FreeCAD.closeDocument(FreeCAD.ActiveDocument.Name)\n";
+    auto failing = dir / "batchFail.py";
+    std::ofstream(failing) << "raise RuntimeError('batch script failed')\n";
+    auto& config = App::Application::Config();
+    auto count = app.getDocuments().size();
+
+    // Act
+    config["BatchScript"] = closing.string();
+    int closedFailures = App::Application::runBatch({path.string()}, 1);
+    auto closedCount = app.getDocuments().size();
+    config["BatchScript"] = failing.string();
+    int failedFailures = App::Application::runBatch({path.string()}, 1);
+    auto failedCount = app.getDocuments().size();
+    config.erase("BatchScript");
+    std::filesystem::remove(path);
+    std::filesystem::remove(closing);
+    std::filesystem::remove(failing);
+
+    // Assert
+    EXPECT_EQ(closedFailures, 0);
+    EXPECT_EQ(closedCount, count);
+    EXPECT_EQ(failedFailures, 1);
+    EXPECT_EQ(failedCount, count);
+}
+
+TEST_F(DocumentTest, bulkUpdateCoalescesSignals)
+{
+    // Arrange
+    auto existing = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Existing"));
+    int newObjects = 0;
+    std::vector<std::string> changes;
+    auto newConnection = doc()->signalNewObject.connect(
+        [&newObjects](const App::DocumentObject&) { ++newObjects; });
+    auto changeConnection = doc()->signalChangedObject.connect(
+        [&changes](const App::DocumentObject& obj, const App::Property& prop) {
+            changes.push_back(std::string(obj.getNameInDocument()) + "." + prop.getName());
+        });
+
+    // Act
+    {
+        App::BulkUpdateGuard guard(doc());
+        for (int i = 0; i < 3; ++i) {
+            auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+            feature->Integer.setValue(i);
+            feature->Float.setValue(i);
+            existing->Integer.setValue(i);
+        }
+        existing->Float.setValue(1.0);
+        EXPECT_TRUE(doc()->isBulkUpdating());
+        EXPECT_EQ(newObjects, 0);
+        EXPECT_TRUE(changes.empty());
+    }
+    newConnection.disconnect();
+    changeConnection.disconnect();
+
+    // Assert
+    EXPECT_FALSE(doc()->isBulkUpdating());
+    EXPECT_EQ(newObjects, 3);
+    EXPECT_THAT(changes, ::testing::ElementsAre("Existing.Integer", "Existing.Float"));
+    EXPECT_EQ(existing->Integer.getValue(), 2);
+}
+
+TEST_F(DocumentTest, bulkUpdateFlushesBeforeRemoval)
+{
+    // Arrange
+    std::vector<std::string> signals;
+    auto newConnection = doc()->signalNewObject.connect(
+        [&signals](const App::DocumentObject&) { signals.emplace_back("new"); });
+    auto deleteConnection = doc()->signalDeletedObject.connect(
+        [&signals](const App::DocumentObject&) { signals.emplace_back("deleted"); });
+
+    // Act
+    doc()->beginBulkUpdate();
+    auto feature = doc()->addObject("App::FeatureTest", "Removed");
+    doc()->removeObject(feature->getNameInDocument());
+    doc()->endBulkUpdate();
+    newConnection.disconnect();
+    deleteConnection.disconnect();
+
+    // Assert
+    EXPECT_THAT(signals, ::testing::ElementsAre("new", "deleted"));
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(DocumentTest, DISABLED_benchmarkBulkUpdate)
+{
+    constexpr int count = 100000;
+    std::size_t signals = 0;
+    auto newConnection = doc()->signalNewObject.connect(
+        [&signals](const App::DocumentObject&) { ++signals; });
+    auto changeConnection = doc()->signalChangedObject.connect(
+        [&signals](const App::DocumentObject&, const App::Property&) { ++signals; });
+    auto createObjects = [this](bool bulk) {
+        auto start = std::chrono::steady_clock::now();
+        std::optional<App::BulkUpdateGuard> guard;
+        if (bulk) {
+            guard.emplace(doc());
+        }
+        for (int i = 0; i < count; ++i) {
+            auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+            feature->Integer.setValue(i);
+            feature->Float.setValue(i);
+            feature->String.setValue("bulk");
+        }
+        guard.reset();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double immediateTime = createObjects(false);
+    std::size_t immediateSignals = signals;
+    doc()->clearDocument();
+
+    signals = 0;
+    double bulkTime = createObjects(true);
+    std::size_t bulkSignals = signals;
+    newConnection.disconnect();
+    changeConnection.disconnect();
+
+    EXPECT_LT(bulkSignals, immediateSignals);
+    std::cout << count << " objects: " << immediateTime << " s and " << immediateSignals
+              << " signals, bulk update " << bulkTime << " s and " << bulkSignals
+              << " signals" << std::endl;
+}
+
+TEST_F(DocumentTest, copyObjectMapsLinksBetweenCopies)
+{
+    // Arrange
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    auto other = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Other"));
+    second->Source1.setValue(first);
+    second->Source2.setValue(other);
+    second->LinkList.setValues({first, other});
+    second->IntegerList.setValues({1, 2, 3});
+    auto extra = dynamic_cast<App::PropertyInteger*>(
+        second->addDynamicProperty("App::PropertyInteger", "Extra", "Test"));
+    ASSERT_NE(extra, nullptr);
+    extra->setValue(42);
+
+    // Act
+    auto copies = doc()->copyObject({first, second}, false, true);
+
+    // Assert
+    ASSERT_EQ(copies.size(), 2U);
+    auto firstCopy = static_cast<App::FeatureTest*>(copies[0]);
+    auto secondCopy = static_cast<App::FeatureTest*>(copies[1]);
+    EXPECT_NE(firstCopy, first);
+    EXPECT_NE(secondCopy, second);
+    EXPECT_EQ(secondCopy->Source1.getValue(), firstCopy);
+    EXPECT_EQ(secondCopy->Source2.getValue(), other);
+    EXPECT_THAT(secondCopy->LinkList.getValues(), ::testing::ElementsAre(firstCopy, other));
+    EXPECT_THAT(secondCopy->IntegerList.getValues(), ::testing::ElementsAre(1, 2, 3));
+    auto extraCopy = dynamic_cast<App::PropertyInteger*>(secondCopy->getPropertyByName("Extra"));
+    ASSERT_NE(extraCopy, nullptr);
+    EXPECT_EQ(extraCopy->getValue(), 42);
+    EXPECT_EQ(second->Source1.getValue(), first);
+}
+
+TEST_F(DocumentTest, copyObjectFromOtherDocumentInMemory)
+{
+    // Arrange
+    std::string otherName = App::GetApplication().getUniqueDocumentName("other");
+    auto otherDoc = App::GetApplication().newDocument(otherName.c_str(), "testUser");
+    auto first = static_cast<App::FeatureTest*>(otherDoc->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(otherDoc->addObject("App::FeatureTest", "Second"));
+    second->Source1.setValue(first);
+    second->IntegerList.setValues({1, 2, 3});
+    std::vector<App::DocumentObject*> viewSources;
+    std::vector<App::DocumentObject*> viewCopies;
+    fastsignals::scoped_connection conn = doc()->signalCopyViewObjects.connect(
+        [&](const std::vector<App::DocumentObject*>& objs,
+            const std::vector<App::DocumentObject*>& copies) {
+            viewSources = objs;
+            viewCopies = copies;
+        });
+
+    // Act
+    auto copies = doc()->copyObject({first, second}, false, true);
+
+    // Assert
+    ASSERT_EQ(copies.size(), 2U);
+    auto firstCopy = static_cast<App::FeatureTest*>(copies[0]);
+    auto secondCopy = static_cast<App::FeatureTest*>(copies[1]);
+    EXPECT_EQ(firstCopy->getDocument(), doc());
+    EXPECT_EQ(secondCopy->getDocument(), doc());
+    EXPECT_EQ(secondCopy->Source1.getValue(), firstCopy);
+    EXPECT_THAT(secondCopy->IntegerList.getValues(), ::testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(viewSources, ::testing::ElementsAre(first, second));
+    EXPECT_THAT(viewCopies, ::testing::ElementsAre(firstCopy, secondCopy));
+    App::GetApplication().closeDocument(otherName.c_str());
+}
+
+TEST_F(DocumentTest, copyObjectFallsBackToXmlPerObject)
+{
+    // Arrange
+    auto base = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Base"));
+    auto first = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "First"));
+    auto second = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest", "Second"));
+    first->Source1.setValue(base);
+    std::shared_ptr<App::Expression> expr(App::Expression::parse(first, "1 + 1"));
+    first->setExpression(App::ObjectIdentifier(first->Integer), expr);
+    second->Source1.setValue(first);
+    second->Source2.setValue(base);
+
+    // Act
+    auto copies = doc()->copyObject({base, first, second}, false, true);
+
+    // Assert
+    ASSERT_EQ(copies.size(), 3U);
+    auto baseCopy = static_cast<App::FeatureTest*>(copies[0]);
+    auto firstCopy = static_cast<App::FeatureTest*>(copies[1]);
+    auto secondCopy = static_cast<App::FeatureTest*>(copies[2]);
+    EXPECT_NE(baseCopy, base);
+    EXPECT_NE(firstCopy, first);
+    EXPECT_NE(secondCopy, second);
+    EXPECT_EQ(firstCopy->Source1.getValue(), baseCopy);
+    EXPECT_EQ(firstCopy->ExpressionEngine.numExpressions(), 1U);
+    EXPECT_EQ(secondCopy->Source1.getValue(), firstCopy);
+    EXPECT_EQ(secondCopy->Source2.getValue(), baseCopy);
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(DocumentTest, DISABLED_benchmarkCopyObject)
+{
+    constexpr int count = 5000;
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool oldValue = hGrp->GetBool("CopyInMemory", true);
+    std::vector<App::DocumentObject*> objs;
+    App::DocumentObject* previous = nullptr;
+    for (int i = 0; i < count; ++i) {
+        auto feature = static_cast<App::FeatureTest*>(doc()->addObject("App::FeatureTest"));
+        feature->Integer.setValue(i);
+        feature->IntegerList.setValues({i, i + 1, i + 2});
+        feature->Source1.setValue(previous);
+        previous = feature;
+        objs.push_back(feature);
+    }
+    auto copyObjects = [this, &objs, hGrp](bool inMemory) {
+        hGrp->SetBool("CopyInMemory", inMemory);
+        auto start = std::chrono::steady_clock::now();
+        auto copies = doc()->copyObject(objs);
+        double time =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(copies.size(), objs.size());
+        return time;
+    };
+
+    double xmlTime = copyObjects(false);
+    double memoryTime = copyObjects(true);
+    hGrp->SetBool("CopyInMemory", oldValue);
+
+    std::cout << count << " objects: XML copy " << xmlTime << " s, in-memory copy "
+              << memoryTime << " s" << std::endl;
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -8,6 +8,7 @@
 #include <App/Application.h>
 #include <App/Document.h>
 #include <App/DocumentObject.h>
+#include <App/DocumentObjectGroup.h>
 #include <App/GeoFeatureGroupExtension.h>
 #include <Base/Interpreter.h>
 
@@ -155,4 +156,72 @@ TEST_F(DocumentObjectTest, getSubObjectList)
     EXPECT_EQ(sizesFlatten[1], strlen(fuseName) + strlen(boxName) + 2);
 }
 
+TEST_F(DocumentObjectTest, recursiveListsFollowLinkChanges)
+{
+    // Arrange
+    auto obj = _doc->addObject("App::FeatureTest");
+    auto inner = _doc->addObject<App::DocumentObjectGroup>();
+    auto outer = _doc->addObject<App::DocumentObjectGroup>();
+    inner->addObject(obj);
+    outer->addObject(inner);
+
+    // Act
+    auto inList = obj->getInListRecursive();
+    auto outList = outer->getOutListRecursive();
+    auto epoch = DocumentObject::getDependencyEpoch(_doc);
+
+    // Assert
+    EXPECT_THAT(inList, ::testing::UnorderedElementsAre(inner, outer));
+    EXPECT_THAT(outList, ::testing::UnorderedElementsAre(inner, obj));
+    EXPECT_EQ(obj->getInListRecursive(), inList);
+    EXPECT_EQ(DocumentObject::getDependencyEpoch(_doc), epoch);
+
+    // Act
+    outer->removeObject(inner);
+
+    // Assert
+    EXPECT_NE(DocumentObject::getDependencyEpoch(_doc), epoch);
+    EXPECT_THAT(obj->getInListRecursive(), ::testing::ElementsAre(inner));
+    EXPECT_THAT(obj->getInListEx(true), ::testing::ElementsAre(inner));
+    EXPECT_TRUE(outer->getOutListRecursive().empty());
+    EXPECT_TRUE(obj->isInInListRecursive(inner));
+    EXPECT_FALSE(obj->isInInListRecursive(outer));
+
+    // Act
+    _doc->removeObject(inner->getNameInDocument());
+
+    // Assert
+    EXPECT_TRUE(obj->getInListRecursive().empty());
+}
+
+TEST_F(DocumentObjectTest, dependencyEpochIsPerDocument)
+{
+    // Arrange
+    auto obj = _doc->addObject("App::FeatureTest");
+    auto group = _doc->addObject<App::DocumentObjectGroup>();
+    group->addObject(obj);
+    std::string otherName = App::GetApplication().getUniqueDocumentName("other");
+    auto otherDoc = App::GetApplication().newDocument(otherName.c_str(), "testUser");
+    auto otherObj = otherDoc->addObject("App::FeatureTest");
+    auto otherGroup = otherDoc->addObject<App::DocumentObjectGroup>();
+    auto epoch = DocumentObject::getDependencyEpoch(_doc);
+    auto otherEpoch = DocumentObject::getDependencyEpoch(otherDoc);
+
+    // Act
+    otherGroup->addObject(otherObj);
+
+    // Assert
+    EXPECT_EQ(DocumentObject::getDependencyEpoch(_doc), epoch);
+    EXPECT_NE(DocumentObject::getDependencyEpoch(otherDoc), otherEpoch);
+    EXPECT_THAT(obj->getInListRecursive(), ::testing::ElementsAre(group));
+
+    // Act
+    otherGroup->removeObject(otherObj);
+    App::GetApplication().closeDocument(otherName.c_str());
+
+    // Assert
+    EXPECT_EQ(DocumentObject::getDependencyEpoch(_doc), epoch);
+    EXPECT_THAT(obj->getInListRecursive(), ::testing::ElementsAre(group));
+}
+
 // NOLINTEND(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
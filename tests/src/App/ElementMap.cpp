@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <iostream>
+#include <string>
+
 #include <App/Application.h>
 #include <App/ElementMap.h>
 #include <src/App/InitApplication.h>
@@ -560,4 +563,104 @@ TEST_F(ElementMapTest, addAndGetChildElementsTest)
         return e.indexedName.toString() == "Pong2";
     }));
 }
+TEST_F(ElementMapTest, compactKeepsQueries)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    auto& elementMap = *cube.elementMapPtr;
+    Data::IndexedName face("Face", 2);
+    Data::MappedName extraName("EXTRA");
+    elementMap.setElementName(face, extraName, cube.Tag, _sids);
+    auto before = elementMap.getAll();
+    auto sizeBefore = elementMap.size();
+
+    // Act
+    elementMap.compact();
+
+    // Assert
+    EXPECT_TRUE(elementMap.isCompact());
+    EXPECT_EQ(elementMap.size(), sizeBefore);
+    auto after = elementMap.getAll();
+    ASSERT_EQ(after.size(), before.size());
+    for (std::size_t i = 0; i < before.size(); ++i) {
+        EXPECT_EQ(after[i].name, before[i].name);
+        EXPECT_EQ(after[i].index, before[i].index);
+        EXPECT_EQ(elementMap.find(before[i].name), before[i].index);
+    }
+    EXPECT_EQ(elementMap.find(extraName), face);
+    EXPECT_EQ(elementMap.findAll(face).size(), 2);
+    EXPECT_FALSE(elementMap.find(Data::MappedName("Face7")));
+}
+
+TEST_F(ElementMapTest, compactKeepsQueriesOfManyNames)
+{
+    // Arrange
+    Data::ElementMap elementMap;
+    const int count = 5000;
+    for (int i = 1; i <= count; ++i) {
+        Data::IndexedName face("Face", i);
+        elementMap.setElementName(face, Data::MappedName("F" + std::to_string(i)), 1L);
+    }
+
+    // Act
+    elementMap.compact();
+
+    // Assert, the names must still be found after the storage got shrunk
+    EXPECT_TRUE(elementMap.isCompact());
+    for (int i = 1; i <= count; ++i) {
+        EXPECT_EQ(elementMap.find(Data::MappedName("F" + std::to_string(i))),
+                  Data::IndexedName("Face", i));
+    }
+}
+
+TEST_F(ElementMapTest, compactExpandsOnChange)
+{
+    // Arrange
+    LessComplexPart cube(1L, "Box", _hasher);
+    auto& elementMap = *cube.elementMapPtr;
+    Data::IndexedName face1("Face", 1);
+    Data::IndexedName face7("Face", 7);
+    elementMap.compact();
+    auto sizeBefore = elementMap.size();
+
+    // Act
+    elementMap.setElementName(face7, Data::MappedName(face7), cube.Tag);
+    elementMap.erase(face1);
+
+    // Assert
+    EXPECT_FALSE(elementMap.isCompact());
+    EXPECT_EQ(elementMap.size(), sizeBefore);
+    EXPECT_EQ(elementMap.find(Data::MappedName(face7)), face7);
+    EXPECT_FALSE(elementMap.find(Data::MappedName(face1)));
+    EXPECT_EQ(elementMap.find(Data::MappedName("Face2")), Data::IndexedName("Face", 2));
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(ElementMapTest, DISABLED_memoryCompactVersusTree)
+{
+    // Names shaped like those of a solid with 50k faces after a few operations
+    const int faceCount = 50000;
+    Data::ElementMap elementMap;
+    elementMap.hasher = _hasher;
+    for (const char* type : {"Face", "Edge", "Vertex"}) {
+        for (int i = 1; i <= faceCount; ++i) {
+            Data::IndexedName element(type, i);
+            std::string name = ";:H" + std::to_string(i % 97) + ":7,E;:G(" + type
+                + std::to_string(i) + ";:H2,F);XTR;:H11:4,F";
+            elementMap.setElementName(element, Data::MappedName(name.c_str()), 1L);
+        }
+    }
+    auto size = elementMap.size();
+    auto treeSize = elementMap.getMemSize();
+
+    elementMap.compact();
+    auto compactSize = elementMap.getMemSize();
+
+    EXPECT_EQ(elementMap.size(), size);
+    EXPECT_LT(compactSize, treeSize);
+    std::cout << size << " names\n";
+    std::cout << "tree: " << treeSize / 1024 << " KiB\n";
+    std::cout << "compact: " << compactSize / 1024 << " KiB\n";
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -341,4 +341,90 @@ TEST_F(LinkTest, linkPlacementAndPlacementStayInSync)
     EXPECT_DOUBLE_EQ(synced2.getPosition().z, 9.0);
 }
 
+// -- collapsed arrays --
+
+TEST_F(LinkTest, elementObjectOfCollapsedArrayIsCreatedOnDemand)
+{
+    auto* link = addLink(_doc);
+    link->ShowElement.setValue(false);
+    link->ElementCount.setValue(5);
+    EXPECT_TRUE(link->ElementList.getValues().empty());
+    EXPECT_EQ(link->PlacementList.getSize(), 5);
+
+    EXPECT_EQ(link->getElementObject(2, false), nullptr);
+    auto* element = dynamic_cast<App::LinkElement*>(link->getElementObject(2));
+    ASSERT_NE(element, nullptr);
+    EXPECT_EQ(link->getElementObject(2), element);
+    EXPECT_EQ(link->getElementObjects().size(), 1U);
+    EXPECT_EQ(element->Placement.getValue(), link->PlacementList[2]);
+    EXPECT_EQ(link->getElementObject(5), nullptr);
+}
+
+TEST_F(LinkTest, elementObjectOfCollapsedArrayFollowsVisibility)
+{
+    auto* link = addLink(_doc);
+    link->ShowElement.setValue(false);
+    link->ElementCount.setValue(5);
+    link->setElementVisible("1", false);
+
+    auto* element = link->getElementObject(1);
+    ASSERT_NE(element, nullptr);
+    EXPECT_EQ(link->isElementVisible(element->getNameInDocument()), 0);
+
+    link->setElementVisible(element->getNameInDocument(), true);
+    EXPECT_EQ(link->isElementVisible("1"), 1);
+    EXPECT_EQ(link->isElementVisible(element->getNameInDocument()), 1);
+}
+
+TEST_F(LinkTest, elementObjectOfCollapsedArrayWritesBack)
+{
+    auto* link = addLink(_doc);
+    link->ShowElement.setValue(false);
+    link->ElementCount.setValue(5);
+    auto* element = dynamic_cast<App::LinkElement*>(link->getElementObject(3));
+    ASSERT_NE(element, nullptr);
+
+    Base::Placement pl(Base::Vector3d(10, 20, 30), Base::Rotation());
+    element->Placement.setValue(pl);
+    EXPECT_EQ(link->PlacementList[3], pl);
+    element->ScaleVector.setValue(1.0, 2.0, 3.0);
+    EXPECT_EQ(link->ScaleList[3], Base::Vector3d(1.0, 2.0, 3.0));
+
+    Base::Placement pl2(Base::Vector3d(7, 8, 9), Base::Rotation());
+    link->PlacementList.set1Value(3, pl2);
+    EXPECT_EQ(element->Placement.getValue(), pl2);
+}
+
+TEST_F(LinkTest, elementObjectOfCollapsedArrayIsReleased)
+{
+    auto* link = addLink(_doc);
+    link->ShowElement.setValue(false);
+    link->ElementCount.setValue(5);
+    auto* element = link->getElementObject(4);
+    ASSERT_NE(element, nullptr);
+    std::string name = element->getNameInDocument();
+
+    link->ElementCount.setValue(3);
+    EXPECT_TRUE(link->getElementObjects().empty());
+    EXPECT_EQ(_doc->getObject(name.c_str()), nullptr);
+
+    ASSERT_NE(link->getElementObject(1), nullptr);
+    link->releaseElementObjects();
+    EXPECT_TRUE(link->getElementObjects().empty());
+}
+
+TEST_F(LinkTest, elementObjectIsReclaimedOnExpand)
+{
+    auto* link = addLink(_doc);
+    link->ShowElement.setValue(false);
+    link->ElementCount.setValue(3);
+    auto* element = link->getElementObject(1);
+    ASSERT_NE(element, nullptr);
+
+    link->ShowElement.setValue(true);
+    ASSERT_EQ(link->ElementList.getSize(), 3);
+    EXPECT_EQ(link->ElementList[1], element);
+    EXPECT_EQ(link->getElementObject(1), element);
+}
+
 // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
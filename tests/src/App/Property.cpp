@@ -25,6 +25,8 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <FCConfig.h>
 
 #include <Base/Writer.h>
@@ -57,6 +59,42 @@ TEST(PropertyLink, TestSetValues)
     EXPECT_EQ(sub[1], "Sub2");
 }
 
+TEST(PropertyFloatList, copySharesValuesUntilModified)
+{
+    App::PropertyFloatList prop;
+    prop.setValues({1.0, 2.0, 3.0});
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+    auto copyList = static_cast<App::PropertyFloatList*>(copy.get());
+    EXPECT_EQ(copyList->getValues().data(), prop.getValues().data());
+
+    App::PropertyFloatList pasted;
+    pasted.Paste(prop);
+    EXPECT_EQ(pasted.getValues().data(), prop.getValues().data());
+
+    prop.set1Value(1, 5.0);
+    EXPECT_NE(copyList->getValues().data(), prop.getValues().data());
+    EXPECT_EQ(prop.getValues(), std::vector<double>({1.0, 5.0, 3.0}));
+    EXPECT_EQ(copyList->getValues(), std::vector<double>({1.0, 2.0, 3.0}));
+    EXPECT_EQ(pasted.getValues(), std::vector<double>({1.0, 2.0, 3.0}));
+}
+
+TEST(PropertyFloatList, sharedValuesAreCountedOnce)
+{
+    App::PropertyFloatList prop;
+    prop.setValues(std::vector<double>(100, 1.0));
+    const unsigned int size = prop.getMemSize();
+
+    std::unique_ptr<App::Property> copy(prop.Copy());
+
+    EXPECT_EQ(size, 100 * sizeof(double));
+    EXPECT_EQ(prop.getMemSize() + copy->getMemSize(), size);
+
+    prop.set1Value(0, 2.0);
+    EXPECT_EQ(prop.getMemSize(), size);
+    EXPECT_EQ(copy->getMemSize(), size);
+}
+
 class PropertyFloatTest: public ::testing::Test
 {
 protected:
@@ -907,3 +945,91 @@ TEST_F(MoveProperty, redoExpressionTargetContainerOtherDoc)
 {
     testRedoMovePropertyExpression(varSetDoc2, varSetDoc2, "Variable", "test#VarSet.Variable");
 }
+
+class PropertyLookup: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        docName = App::GetApplication().getUniqueDocumentName("test");
+        doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+        varSet = freecad_cast<App::VarSet*>(doc->addObject("App::VarSet", "VarSet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(docName.c_str());
+    }
+
+    std::string docName;
+    App::Document* doc {};
+    App::VarSet* varSet {};
+};
+
+TEST_F(PropertyLookup, staticProperties)
+{
+    std::vector<std::pair<const char*, App::Property*>> props;
+    varSet->getPropertyNamedList(props);
+    ASSERT_FALSE(props.empty());
+
+    for (const auto& [name, prop] : props) {
+        // Both the stored name and a copy of it are found
+        EXPECT_EQ(varSet->getPropertyByName(name), prop);
+        EXPECT_EQ(varSet->getPropertyByName(std::string(name).c_str()), prop);
+    }
+    EXPECT_EQ(varSet->getPropertyByName("Label"), &varSet->Label);
+    EXPECT_EQ(varSet->getPropertyByName("NoSuchProperty"), nullptr);
+    EXPECT_EQ(varSet->getPropertyByName(""), nullptr);
+    EXPECT_EQ(varSet->getPropertyByName(nullptr), nullptr);
+}
+
+TEST_F(PropertyLookup, dynamicProperties)
+{
+    auto prop = varSet->addDynamicProperty("App::PropertyInteger", "Variable");
+    EXPECT_EQ(varSet->getPropertyByName(prop->getName()), prop);
+    EXPECT_EQ(varSet->getPropertyByName(std::string("Variable").c_str()), prop);
+    EXPECT_EQ(varSet->getPropertyByName("Variable2"), nullptr);
+
+    varSet->renameDynamicProperty(prop, "Renamed");
+    EXPECT_EQ(varSet->getPropertyByName("Variable"), nullptr);
+    EXPECT_EQ(varSet->getPropertyByName("Renamed"), prop);
+
+    varSet->removeDynamicProperty("Renamed");
+    EXPECT_EQ(varSet->getPropertyByName("Renamed"), nullptr);
+    EXPECT_EQ(varSet->getPropertyByName("Label"), &varSet->Label);
+}
+
+TEST_F(PropertyLookup, manyDynamicProperties)
+{
+    // Enough properties to grow the lookup table several times
+    const int count = 500;
+    auto name = [](int i) {
+        return "Variable" + std::to_string(i);
+    };
+    std::vector<App::Property*> props;
+    for (int i = 0; i < count; ++i) {
+        props.push_back(varSet->addDynamicProperty("App::PropertyInteger", name(i).c_str()));
+    }
+
+    // Remove every other property, then add some of them back
+    for (int i = 0; i < count; i += 2) {
+        varSet->removeDynamicProperty(name(i).c_str());
+    }
+    for (int i = 0; i < count; i += 4) {
+        props[i] = varSet->addDynamicProperty("App::PropertyInteger", name(i).c_str());
+    }
+
+    for (int i = 0; i < count; ++i) {
+        bool removed = i % 2 == 0 && i % 4 != 0;
+        EXPECT_EQ(varSet->getPropertyByName(name(i).c_str()), removed ? nullptr : props[i])
+            << name(i);
+    }
+    EXPECT_EQ(varSet->getPropertyByName("Label"), &varSet->Label);
+    EXPECT_EQ(varSet->getPropertyByName("ExpressionEngine"), &varSet->ExpressionEngine);
+    EXPECT_EQ(varSet->getPropertyByName(name(count).c_str()), nullptr);
+}
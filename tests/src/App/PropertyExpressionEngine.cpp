@@ -10,8 +10,10 @@
 #include "App/Expression.h"
 #include "App/ObjectIdentifier.h"
 #include "App/PropertyExpressionEngine.h"
+#include "App/PropertyStandard.h"
 
 #include "src/App/InitApplication.h"
+#include "src/App/ScopedParameter.h"
 
 // clang-format off
 
@@ -92,4 +94,70 @@ TEST_F(PropertyExpressionEngineTest, executeCrossPropertyReference)
     ;
 }
 
+TEST_F(PropertyExpressionEngineTest, executeOnlyChangedBindings)
+{
+    tests::ScopedParameter incremental("User parameter:BaseApp/Preferences/Expression",
+                                       "IncrementalEvaluation", true);
+
+    auto obj = this_obj();
+    auto addInteger = [obj](const char* name) {
+        return freecad_cast<App::PropertyInteger*>(
+            obj->addDynamicProperty("App::PropertyInteger", name));
+    };
+    auto first = addInteger("First");
+    auto second = addInteger("Second");
+    auto twice = addInteger("Twice");
+    auto next = addInteger("Next");
+    auto triple = addInteger("Triple");
+    auto constant = addInteger("Constant");
+    first->setValue(1);
+    second->setValue(2);
+
+    auto bind = [obj](App::Property* prop, const char* expr) {
+        std::shared_ptr<App::Expression> rule(App::Expression::parse(obj, expr));
+        obj->setExpression(App::ObjectIdentifier(*prop), rule);
+    };
+    bind(twice, "First * 2");
+    bind(next, "Twice + 1");
+    bind(triple, "Second * 3");
+    bind(constant, "5");
+
+    auto& engine = obj->ExpressionEngine;
+    engine.resetCounters();
+    engine.execute();
+    EXPECT_EQ(engine.getEvaluatedCount(), 4U);
+    EXPECT_EQ(engine.getSkippedCount(), 0U);
+    EXPECT_EQ(next->getValue(), 3);
+    EXPECT_EQ(triple->getValue(), 6);
+
+    // Nothing changed
+    engine.resetCounters();
+    engine.execute();
+    EXPECT_EQ(engine.getEvaluatedCount(), 0U);
+    EXPECT_EQ(engine.getSkippedCount(), 4U);
+
+    // Only the bindings downstream of the changed input are evaluated
+    engine.resetCounters();
+    first->setValue(10);
+    engine.execute();
+    EXPECT_EQ(engine.getEvaluatedCount(), 2U);
+    EXPECT_EQ(engine.getSkippedCount(), 2U);
+    EXPECT_EQ(twice->getValue(), 20);
+    EXPECT_EQ(next->getValue(), 21);
+
+    // A bound property changed by someone else is restored
+    engine.resetCounters();
+    triple->setValue(0);
+    engine.execute();
+    EXPECT_EQ(engine.getEvaluatedCount(), 1U);
+    EXPECT_EQ(triple->getValue(), 6);
+
+    // Changing an expression evaluates all bindings again
+    engine.resetCounters();
+    bind(constant, "7");
+    engine.execute();
+    EXPECT_EQ(engine.getEvaluatedCount(), 4U);
+    EXPECT_EQ(constant->getValue(), 7);
+}
+
 // clang-format on
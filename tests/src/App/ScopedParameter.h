@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include <App/Application.h>
+
+namespace tests
+{
+
+// Sets a boolean preference and restores it when going out of scope
+class ScopedParameter
+{
+public:
+    ScopedParameter(const char* path, const char* name, bool value)
+        : hGrp(App::GetApplication().GetParameterGroupByPath(path))
+        , name(name)
+    {
+        for (const auto& [key, old] : hGrp->GetBoolMap(name)) {
+            if (key == name) {
+                oldValue = old;
+            }
+        }
+        hGrp->SetBool(name, value);
+    }
+    ~ScopedParameter()
+    {
+        if (oldValue) {
+            hGrp->SetBool(name.c_str(), *oldValue);
+        }
+        else {
+            hGrp->RemoveBool(name.c_str());
+        }
+    }
+    ScopedParameter(const ScopedParameter&) = delete;
+    ScopedParameter& operator=(const ScopedParameter&) = delete;
+
+private:
+    ParameterGrp::handle hGrp;
+    std::string name;
+    std::optional<bool> oldValue;
+};
+
+}  // namespace tests
@@ -9,6 +9,10 @@
 
 #include <QCryptographicHash>
 #include <array>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
 
 class StringIDTest: public ::testing::Test
 {
@@ -1586,3 +1590,41 @@ TEST_F(StringHasherTest, compact)  // NOLINT
     // Assert
     EXPECT_EQ(0, Hasher()->count());
 }
+
+TEST_F(StringHasherTest, concurrentGetID)  // NOLINT
+{
+    // Arrange
+    const int threadCount {8};
+    const int nameCount {2000};
+    const int rounds {20};
+    std::vector<std::vector<long>> foundIDs(threadCount, std::vector<long>(nameCount));
+
+    // Act - every thread looks up the same names, starting at a different one
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([this, thread, &foundIDs]() {
+            QVector<App::StringIDRef> sids;
+            for (int i = 0; i < nameCount * rounds; ++i) {
+                int index = (i + thread * nameCount / threadCount) % nameCount;
+                std::string name = "Edge" + std::to_string(index);
+                auto ID = Hasher()->getID(givenMappedName(name.c_str()), sids);
+                foundIDs[thread][index] = ID.value();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Assert
+    std::set<long> uniqueIDs;
+    for (int index = 0; index < nameCount; ++index) {
+        for (int thread = 1; thread < threadCount; ++thread) {
+            ASSERT_EQ(foundIDs[0][index], foundIDs[thread][index]);
+        }
+        uniqueIDs.insert(foundIDs[0][index]);
+    }
+    EXPECT_EQ(nameCount, static_cast<int>(uniqueIDs.size()));
+    EXPECT_EQ(nameCount, static_cast<int>(Hasher()->size()));
+    EXPECT_EQ(nameCount, Hasher()->lastID());  // IDs are handed out without gaps
+}
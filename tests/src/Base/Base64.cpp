@@ -27,9 +27,15 @@ the tests into individual parts.
 */
 
 #include "Base/Base64.h"
+#include "Base/Base64Filter.h"
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+
 using namespace Base;
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -91,4 +97,112 @@ TEST(Base64, oneEqualsSignPadding)
     ASSERT_EQ(rest2_decoded, rest2_original);
 }
 
+namespace
+{
+
+std::string randomData(std::size_t size)
+{
+    std::mt19937 generator(size);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::string data(size, '\0');
+    for (auto& byte : data) {
+        byte = static_cast<char>(distribution(generator));
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(Base64, kernelsMatchScalar)
+{
+    auto oldKernel = base64_kernel();
+    for (std::size_t size = 0; size < 200; ++size) {
+        auto data = randomData(size);
+        base64_set_kernel(Base64Kernel::Scalar);
+        auto reference = base64_encode(data.c_str(), data.size());
+        for (auto kernel : {Base64Kernel::SSE41, Base64Kernel::AVX2}) {
+            base64_set_kernel(kernel);
+            auto encoded = base64_encode(data.c_str(), data.size());
+            EXPECT_EQ(encoded, reference) << "size " << size;
+            EXPECT_EQ(base64_decode(encoded), data) << "size " << size;
+
+            // decoding stops at the same invalid character
+            if (!encoded.empty()) {
+                encoded[size % encoded.size()] = '!';
+                std::string partial;
+                auto read = base64_decode(partial, encoded);
+                base64_set_kernel(Base64Kernel::Scalar);
+                std::string scalarPartial;
+                EXPECT_EQ(read, base64_decode(scalarPartial, encoded)) << "size " << size;
+                EXPECT_EQ(partial, scalarPartial) << "size " << size;
+            }
+        }
+    }
+    base64_set_kernel(oldKernel);
+}
+
+TEST(Base64, filterRoundTrip)
+{
+    auto data = randomData(100000);
+    std::ostringstream encoded;
+    {
+        auto encoder = create_base64_encoder(encoded);
+        encoder->write(data.c_str(), static_cast<std::streamsize>(data.size()));
+    }
+    std::istringstream input(encoded.str());
+    auto decoder = create_base64_decoder(input);
+    std::string decoded((std::istreambuf_iterator<char>(*decoder)), std::istreambuf_iterator<char>());
+
+    EXPECT_NE(encoded.str().find('\n'), std::string::npos);
+    EXPECT_EQ(decoded, data);
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST(Base64, DISABLED_benchmarkThroughput)
+{
+    constexpr std::size_t size = 64 * 1024 * 1024;
+    auto data = randomData(size);
+    auto oldKernel = base64_kernel();
+    auto megabytesPerSecond = [](std::chrono::steady_clock::duration duration) {
+        return static_cast<double>(size) / 1e6 / std::chrono::duration<double>(duration).count();
+    };
+
+    for (auto kernel : {Base64Kernel::Scalar, Base64Kernel::SSE41, Base64Kernel::AVX2}) {
+        if (base64_set_kernel(kernel) != kernel) {
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        auto encoded = base64_encode(data.c_str(), data.size());
+        auto encodeTime = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        auto decoded = base64_decode(encoded);
+        auto decodeTime = std::chrono::steady_clock::now() - start;
+
+        std::ostringstream lines;
+        start = std::chrono::steady_clock::now();
+        {
+            auto encoder = create_base64_encoder(lines);
+            encoder->write(data.c_str(), static_cast<std::streamsize>(data.size()));
+        }
+        auto filterEncodeTime = std::chrono::steady_clock::now() - start;
+
+        std::istringstream input(lines.str());
+        std::string filtered(size, '\0');
+        start = std::chrono::steady_clock::now();
+        auto decoder = create_base64_decoder(input);
+        decoder->read(filtered.data(), static_cast<std::streamsize>(size));
+        auto filterDecodeTime = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(decoded, data);
+        EXPECT_EQ(filtered, data);
+        std::cout << "kernel " << static_cast<int>(kernel) << ": encode "
+                  << megabytesPerSecond(encodeTime) << " MB/s, decode "
+                  << megabytesPerSecond(decodeTime) << " MB/s, filter encode "
+                  << megabytesPerSecond(filterEncodeTime) << " MB/s, filter decode "
+                  << megabytesPerSecond(filterDecodeTime) << " MB/s\n";
+    }
+    base64_set_kernel(oldKernel);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 
 #include <mutex>
+#include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "Base/Console.h"
@@ -49,6 +52,44 @@ private:
     std::mutex& mutex;
 };
 
+class ThreadSafeCapturingLogger final: public Base::ILogger
+{
+public:
+    explicit ThreadSafeCapturingLogger(std::vector<CapturedLog>& out, std::mutex& outMutex)
+        : output(out)
+        , mutex(outMutex)
+    {}
+
+    void sendLog(
+        const std::string& notifiername,
+        const std::string& msg,
+        Base::LogStyle level,
+        Base::IntendedRecipient recipient,
+        Base::ContentType content
+    ) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        output.push_back({notifiername, msg, level, recipient, content});
+        threads.insert(std::this_thread::get_id());
+    }
+
+    const char* name() override
+    {
+        return "ThreadSafeCapturingLogger";
+    }
+
+    bool isThreadSafe() const override
+    {
+        return true;
+    }
+
+    std::set<std::thread::id> threads;
+
+private:
+    std::vector<CapturedLog>& output;
+    std::mutex& mutex;
+};
+
 class ScopedObserver
 {
 public:
@@ -151,3 +192,105 @@ TEST(Console, RefreshCallsHandlerWhenEnabled)
     Base::Console().setRefreshHandler({});
     Base::Console().enableRefresh(true);
 }
+
+TEST(Console, AsyncModeDeliversOnFlush)
+{
+    std::mutex mutex;
+    std::vector<CapturedLog> directLogs;
+    std::vector<CapturedLog> asyncLogs;
+    CapturingLogger direct(directLogs, mutex);
+    ThreadSafeCapturingLogger async(asyncLogs, mutex);
+    ScopedObserver scopedDirect(direct);
+    ScopedObserver scopedAsync(async);
+
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().setAsyncMode(true, 16);
+    EXPECT_TRUE(Base::Console().isAsyncMode());
+
+    constexpr int count = 1000;
+    for (int i = 0; i < count; ++i) {
+        Base::Console().message("%d", i);
+    }
+    Base::Console().flush();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(static_cast<std::size_t>(count), directLogs.size());
+        ASSERT_EQ(static_cast<std::size_t>(count), asyncLogs.size());
+        for (int i = 0; i < count; ++i) {
+            EXPECT_EQ(std::to_string(i), asyncLogs[i].msg);
+        }
+        EXPECT_FALSE(async.threads.contains(std::this_thread::get_id()));
+    }
+
+    Base::Console().setAsyncMode(false);
+}
+
+TEST(Console, AsyncModeKeepsMessagesOfAllThreads)
+{
+    std::mutex mutex;
+    std::vector<CapturedLog> logs;
+    ThreadSafeCapturingLogger logger(logs, mutex);
+    ScopedObserver scoped(logger);
+
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().setAsyncMode(true, 16);
+
+    constexpr int threadCount = 4;
+    constexpr int count = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < count; ++i) {
+                Base::Console().log(std::to_string(t), "%d", i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // disabling delivers the pending messages
+    Base::Console().setAsyncMode(false);
+    EXPECT_FALSE(Base::Console().isAsyncMode());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(static_cast<std::size_t>(threadCount * count), logs.size());
+    std::vector<int> next(threadCount, 0);
+    for (const auto& log : logs) {
+        // the messages of each thread arrive in order
+        int& expected = next[std::stoi(log.notifier)];
+        EXPECT_EQ(std::to_string(expected), log.msg);
+        ++expected;
+    }
+}
+
+TEST(Console, AsyncModeKeepsMessagesSentWhileDisabling)
+{
+    std::mutex mutex;
+    std::vector<CapturedLog> logs;
+    ThreadSafeCapturingLogger logger(logs, mutex);
+    ScopedObserver scoped(logger);
+
+    Base::Console().setConnectionMode(Base::ConsoleSingleton::Direct);
+    Base::Console().setAsyncMode(true, 16);
+
+    constexpr int threadCount = 4;
+    constexpr int count = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < count; ++i) {
+                Base::Console().message("%d", i);
+            }
+        });
+    }
+    // disable the mode while the threads are still sending
+    Base::Console().setAsyncMode(false);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(static_cast<std::size_t>(threadCount * count), logs.size());
+}
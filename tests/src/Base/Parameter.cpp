@@ -4,7 +4,9 @@
 #include <Base/FileLock.h>
 #include <Base/Parameter.h>
 
+#include <chrono>
 #include <filesystem>
+#include <iostream>
 
 #if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
 # include <sys/wait.h>
@@ -511,4 +513,93 @@ TEST_F(ParameterTest, TestLockFile)
     (void)std::filesystem::remove(std::filesystem::path(fn), ec);
 }
 
+TEST_F(ParameterTest, TestCacheFollowsChanges)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    EXPECT_EQ(grp->GetInt("Parameter", 2), 2);
+
+    grp->SetInt("Parameter", 5);
+    EXPECT_EQ(grp->GetInt("Parameter", 2), 5);
+    grp->SetASCII("Text", "Value");
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Value");
+
+    grp->RemoveInt("Parameter");
+    EXPECT_EQ(grp->GetInt("Parameter", 2), 2);
+
+    grp->SetBool("Bool", true);
+    EXPECT_TRUE(grp->GetBool("Bool", false));
+    grp->Clear();
+    EXPECT_FALSE(grp->GetBool("Bool", false));
+    EXPECT_EQ(grp->GetASCII("Text", "Preset"), "Preset");
+}
+
+TEST_F(ParameterTest, TestDeferredUpdate)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+
+    int changes = 0;
+    auto conn = cfg->signalParamChanged.connect(
+        [&changes](ParameterGrp*, ParameterGrp::ParamType, const char*, const char*) {
+            ++changes;
+        }
+    );
+    auto& obs = getObserver();
+    obs.attachSelf(grp);
+
+    {
+        ParameterUpdateLocker locker(cfg);
+        grp->SetFloat("Float", 1.0);
+        grp->SetFloat("Float", 2.0);
+        grp->SetFloat("Float", 3.0);
+        grp->SetASCII("Text", "Value");
+
+        EXPECT_DOUBLE_EQ(grp->GetFloat("Float"), 3.0);
+        EXPECT_EQ(grp->GetASCII("Text"), "Value");
+        EXPECT_EQ(changes, 0);
+        EXPECT_EQ(obs.getCountNotifications(), 0);
+        EXPECT_TRUE(grp->GetFloats().empty());
+    }
+
+    EXPECT_EQ(changes, 2);
+    EXPECT_EQ(obs.getCountNotifications(), 2);
+    EXPECT_EQ(grp->GetFloats().size(), 1U);
+    EXPECT_DOUBLE_EQ(grp->GetFloat("Float"), 3.0);
+
+    // removing is not deferred and discards the kept value
+    cfg->BeginUpdate();
+    grp->SetInt("Int", 4);
+    grp->RemoveInt("Int");
+    EXPECT_EQ(grp->GetInt("Int", 1), 1);
+    cfg->EndUpdate();
+    EXPECT_TRUE(grp->GetInts().empty());
+
+    obs.detachSelf(grp);
+    conn.disconnect();
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(ParameterTest, DISABLED_BenchmarkLookup)
+{
+    auto cfg = getCreateConfig();
+    auto grp = cfg->GetGroup("TopLevelGroup");
+    for (int i = 0; i < 50; ++i) {
+        grp->SetInt(("Parameter" + std::to_string(i)).c_str(), i);
+    }
+
+    constexpr int count = 1000000;
+    long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        sum += grp->GetInt("Parameter49");
+        sum += grp->GetBool("Missing") ? 1 : 0;
+    }
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+    std::cout << count << " lookups of an existing and a missing parameter: " << time.count()
+              << " s\n";
+    EXPECT_EQ(sum, 49L * count);
+}
+
 // NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Base/SharedVector.h>
+
+TEST(SharedVector, copyShares)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    Base::SharedVector<int> copy = vec;
+
+    EXPECT_TRUE(copy.isSharedWith(vec));
+    EXPECT_EQ(copy.values().data(), vec.values().data());
+}
+
+TEST(SharedVector, constAccessDoesNotDetach)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    const Base::SharedVector<int> copy = vec;
+
+    int sum = 0;
+    for (int value : copy) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(copy[1], 2);
+    EXPECT_TRUE(copy.isSharedWith(vec));
+}
+
+TEST(SharedVector, writeDetaches)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    Base::SharedVector<int> copy = vec;
+
+    copy[0] = 5;
+    copy.push_back(4);
+
+    EXPECT_FALSE(copy.isSharedWith(vec));
+    EXPECT_EQ(vec.values(), std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(copy.values(), std::vector<int>({5, 2, 3, 4}));
+}
+
+TEST(SharedVector, uniqueWriteKeepsBuffer)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    const int* data = vec.values().data();
+
+    vec[0] = 5;
+
+    EXPECT_EQ(vec.values().data(), data);
+    EXPECT_FALSE(vec.isShared());
+}
+
+TEST(SharedVector, insertAndEraseOnSharedBuffer)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    const Base::SharedVector<int> copy = vec;
+
+    vec.insert(copy.begin() + 1, 7);
+    vec.erase(vec.begin());
+
+    EXPECT_EQ(vec.values(), std::vector<int>({7, 2, 3}));
+    EXPECT_EQ(copy.values(), std::vector<int>({1, 2, 3}));
+}
+
+TEST(SharedVector, clearReleasesSharedBuffer)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    Base::SharedVector<int> copy = vec;
+
+    copy.clear();
+
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.values().size(), 0U);
+    EXPECT_EQ(vec.size(), 3U);
+}
+
+TEST(SharedVector, useCountFollowsCopies)
+{
+    Base::SharedVector<int> vec {1, 2, 3};
+    EXPECT_EQ(vec.useCount(), 1U);
+
+    Base::SharedVector<int> copy = vec;
+    EXPECT_EQ(vec.useCount(), 2U);
+    EXPECT_EQ(copy.useCount(), 2U);
+
+    copy.clear();
+    EXPECT_EQ(vec.useCount(), 1U);
+}
+
+TEST(SharedVector, defaultIsEmpty)
+{
+    Base::SharedVector<int> vec;
+    const std::vector<int>& values = vec;
+
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(vec.begin(), vec.end());
+}
@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <App/DocumentObjectGroup.h>
+#include <App/GeoFeature.h>
+#include <App/PropertyLinks.h>
+#include <Base/Persistence.h>
+#include <Base/Type.h>
+
+#include <src/App/InitApplication.h>
+
+namespace
+{
+
+// The parent chain walk used before, as reference
+bool isDerivedFromByParents(Base::Type type, const Base::Type parent)
+{
+    do {
+        if (type == parent) {
+            return true;
+        }
+        type = type.getParent();
+    } while (!type.isBad());
+    return false;
+}
+
+}  // namespace
+
+class Type: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(Type, isDerivedFromMatchesParents)
+{
+    std::vector<Base::Type> types;
+    for (int i = 0; i < Base::Type::getNumTypes(); ++i) {
+        types.push_back(Base::Type::fromKey(i));
+    }
+
+    for (const auto& type : types) {
+        for (const auto& parent : types) {
+            ASSERT_EQ(type.isDerivedFrom(parent), isDerivedFromByParents(type, parent))
+                << type.getName() << ", " << parent.getName();
+        }
+    }
+}
+
+TEST_F(Type, badType)
+{
+    auto persistence = Base::Persistence::getClassTypeId();
+    EXPECT_TRUE(Base::Type::BadType.isDerivedFrom(Base::Type::BadType));
+    EXPECT_FALSE(Base::Type::BadType.isDerivedFrom(persistence));
+    EXPECT_FALSE(persistence.isDerivedFrom(Base::Type::BadType));
+}
+
+TEST_F(Type, registeredTypesAreNumbered)
+{
+    auto persistence = Base::Persistence::getClassTypeId();
+    auto base = Base::Type::createType(persistence, "TypeTest::Base");
+    EXPECT_TRUE(base.isDerivedFrom(persistence));
+    EXPECT_FALSE(persistence.isDerivedFrom(base));
+
+    // Types registered after the numbering was last used
+    auto derived = Base::Type::createType(base, "TypeTest::Derived");
+    auto sibling = Base::Type::createType(persistence, "TypeTest::Sibling");
+    auto root = Base::Type::createType(Base::Type::BadType, "TypeTest::Root");
+
+    EXPECT_TRUE(derived.isDerivedFrom(base));
+    EXPECT_TRUE(derived.isDerivedFrom(persistence));
+    EXPECT_TRUE(derived.isDerivedFrom(Base::BaseClass::getClassTypeId()));
+    EXPECT_FALSE(derived.isDerivedFrom(sibling));
+    EXPECT_FALSE(sibling.isDerivedFrom(base));
+    EXPECT_FALSE(base.isDerivedFrom(derived));
+    EXPECT_TRUE(root.isDerivedFrom(root));
+    EXPECT_FALSE(root.isDerivedFrom(Base::BaseClass::getClassTypeId()));
+    EXPECT_FALSE(derived.isDerivedFrom(root));
+
+    std::vector<Base::Type> list;
+    EXPECT_EQ(Base::Type::getAllDerivedFrom(base, list), 2);
+}
+
+TEST_F(Type, typesRegisteredDuringLookupsAreNumbered)
+{
+    auto persistence = Base::Persistence::getClassTypeId();
+    auto baseClass = Base::BaseClass::getClassTypeId();
+
+    // Keep rebuilding the numbering while the types get registered
+    std::atomic<bool> done {false};
+    std::thread lookups([&] {
+        while (!done) {
+            EXPECT_TRUE(persistence.isDerivedFrom(baseClass));
+        }
+    });
+    std::vector<Base::Type> types;
+    for (int i = 0; i < 200; ++i) {
+        auto name = "TypeTest::Concurrent" + std::to_string(i);
+        types.push_back(Base::Type::createType(persistence, name));
+    }
+    done = true;
+    lookups.join();
+
+    for (const auto& type : types) {
+        EXPECT_TRUE(type.isDerivedFrom(persistence)) << type.getName();
+        EXPECT_FALSE(persistence.isDerivedFrom(type)) << type.getName();
+    }
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(Type, DISABLED_documentTraversal)
+{
+    const int count = 2000;
+    const int rounds = 100;
+    std::string docName = App::GetApplication().getUniqueDocumentName("test");
+    auto doc = App::GetApplication().newDocument(docName.c_str(), "testUser");
+    for (int i = 0; i < count; ++i) {
+        doc->addObject(i % 3 == 0 ? "App::DocumentObjectGroup" : "App::Part");
+    }
+
+    // The checks done when walking the tree or filtering a selection
+    auto traverse = [doc](auto isDerivedFrom) {
+        std::size_t matches = 0;
+        for (auto obj : doc->getObjects()) {
+            matches += isDerivedFrom(obj->getTypeId(), App::GeoFeature::getClassTypeId());
+            matches += isDerivedFrom(obj->getTypeId(), App::DocumentObjectGroup::getClassTypeId());
+            std::vector<App::Property*> props;
+            obj->getPropertyList(props);
+            for (auto prop : props) {
+                matches +=
+                    isDerivedFrom(prop->getTypeId(), App::PropertyLinkBase::getClassTypeId());
+            }
+        }
+        return matches;
+    };
+
+    std::size_t parentMatches = 0;
+    std::size_t intervalMatches = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        parentMatches += traverse(isDerivedFromByParents);
+    }
+    auto parents = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        intervalMatches += traverse([](Base::Type type, Base::Type parent) {
+            return type.isDerivedFrom(parent);
+        });
+    }
+    auto intervals = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(intervalMatches, parentMatches);
+    std::cout << "parent chain: " << parents.count() << " us\n";
+    std::cout << "intervals: " << intervals.count() << " us\n";
+
+    App::GetApplication().closeDocument(docName.c_str());
+}
@@ -2,7 +2,19 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
+#include <zipios++/zipfile.h>
+#include <zipios++/zipinputstream.h>
+
 #include "Base/Exception.h"
+#include "Base/FileInfo.h"
+#include "Base/Persistence.h"
 #include "Base/Writer.h"
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
@@ -129,3 +141,171 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+// Saves a fixed payload as an additional file of the archive
+class PayloadFile: public Base::Persistence
+{
+public:
+    PayloadFile(std::string data, bool concurrent)
+        : data(std::move(data))
+        , concurrent(concurrent)
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << data;
+    }
+    bool canSaveDocFileConcurrently() const override
+    {
+        return concurrent;
+    }
+    const std::string& getData() const
+    {
+        return data;
+    }
+    void setData(std::string str)
+    {
+        data = std::move(str);
+    }
+
+private:
+    std::string data;
+    bool concurrent;
+};
+}  // namespace
+
+class ZipWriterTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // every other file is serialized on the calling thread
+        for (int i = 0; i < 12; ++i) {
+            std::string data;
+            for (int j = 0; j < 20000; ++j) {
+                data += std::to_string((i * 7919 + j * 104729) % 1000) + ' ';
+            }
+            _files.emplace_back(data, i % 2 == 0);
+        }
+    }
+
+    std::string writeArchive(
+        unsigned int threads,
+        std::shared_ptr<zipios::ZipFile> previous = nullptr,
+        std::map<const Base::Persistence*, std::string> previousFiles = {},
+        std::size_t* copied = nullptr
+    ) const
+    {
+        std::ostringstream out;
+        {
+            Base::ZipWriter writer(out);
+            writer.setThreadCount(threads);
+            writer.setPreviousFiles(std::move(previous), std::move(previousFiles));
+            writer.putNextEntry("Document.xml");
+            writer.Stream() << "<Document/>";
+            for (const auto& file : _files) {
+                writer.addFile("Payload.txt", &file);
+            }
+            writer.writeFiles();
+            if (copied) {
+                *copied = writer.getCopiedFileCount();
+            }
+        }
+        return out.str();
+    }
+
+    static std::vector<std::pair<std::string, std::string>> readArchive(const std::string& archive)
+    {
+        std::vector<std::pair<std::string, std::string>> entries;
+        std::istringstream in(archive);
+        zipios::ZipInputStream zip(in);
+        // the stream is positioned on Document.xml, the files follow
+        try {
+            zipios::ConstEntryPointer entry = zip.getNextEntry();
+            while (entry && entry->isValid()) {
+                std::string data {std::istreambuf_iterator<char>(zip), {}};
+                entries.emplace_back(entry->getName(), data);
+                entry = zip.getNextEntry();
+            }
+        }
+        catch (const std::exception&) {
+            // there is no further entry
+        }
+        return entries;
+    }
+
+    std::vector<PayloadFile> _files;
+};
+
+TEST_F(ZipWriterTest, concurrentWriteKeepsOrderAndContent)
+{
+    // Act
+    auto sequential = readArchive(writeArchive(1));
+    auto concurrent = readArchive(writeArchive(4));
+
+    // Assert
+    ASSERT_EQ(sequential.size(), _files.size());
+    EXPECT_EQ(sequential, concurrent);
+    for (size_t i = 0; i < _files.size(); ++i) {
+        EXPECT_EQ(concurrent[i].second, _files[i].getData());
+    }
+}
+
+TEST_F(ZipWriterTest, previousFilesAreCopiedVerbatim)
+{
+    // Arrange
+    Base::FileInfo fi(Base::FileInfo::getTempFileName());
+    {
+        std::ofstream file(fi.filePath(), std::ios::out | std::ios::binary);
+        file << writeArchive(1);
+    }
+    auto previous = std::make_shared<zipios::ZipFile>(fi.filePath());
+    std::map<const Base::Persistence*, std::string> previousFiles;
+    previousFiles[&_files[0]] = "Payload.txt";
+    previousFiles[&_files[3]] = "Payload3.txt";
+    std::string original = _files[0].getData();
+    // a copied file is not saved again, so this change must not show up
+    _files[0].setData("changed");
+
+    // Act
+    std::size_t copiedSequential {0};
+    std::size_t copiedConcurrent {0};
+    auto sequential = readArchive(writeArchive(1, previous, previousFiles, &copiedSequential));
+    auto concurrent = readArchive(writeArchive(4, previous, previousFiles, &copiedConcurrent));
+    fi.deleteFile();
+
+    // Assert
+    EXPECT_EQ(copiedSequential, 2);
+    EXPECT_EQ(copiedConcurrent, 2);
+    ASSERT_EQ(sequential.size(), _files.size());
+    EXPECT_EQ(sequential, concurrent);
+    EXPECT_EQ(sequential[0].second, original);
+    for (size_t i = 1; i < _files.size(); ++i) {
+        EXPECT_EQ(sequential[i].second, _files[i].getData());
+    }
+}
+
+// Benchmark, run with --gtest_also_run_disabled_tests
+TEST_F(ZipWriterTest, DISABLED_saveTimeVersusThreadCount)
+{
+    unsigned int cores = std::max(1U, std::thread::hardware_concurrency());
+    for (unsigned int threads = 1; threads <= cores; threads *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 10; ++i) {
+            writeArchive(threads);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start
+        );
+        std::cout << threads << " thread(s): " << elapsed.count() / 10 << " ms per save\n";
+    }
+}